@@ -6,8 +6,9 @@ goto :genn_begin
 :genn_help
 rem :: display genn-buildmodel.bat help
 echo genn-buildmodel.bat script usage:
-echo genn-buildmodel.bat [cdho] model
+echo genn-buildmodel.bat [cdhot] model
 echo -c             only generate simulation code for the CPU
+echo -t             only generate multi-threaded simulation code for the CPU
 echo -l             generate simulation code for OpenCL
 echo -d             enables the debugging mode
 echo -h             shows this help message
@@ -22,7 +23,7 @@ rem :: define genn-buildmodel.bat options separated by spaces
 rem :: -<option>:              option
 rem :: -<option>:""            option with argument
 rem :: -<option>:"<default>"   option with argument and default value
-set "OPTIONS=-o:"%CD%" -i:"" -d: -c: -h: -s: -f: -l:"
+set "OPTIONS=-o:"%CD%" -i:"" -d: -c: -t: -h: -s: -f: -l:"
 for %%O in (%OPTIONS%) do for /f "tokens=1,* delims=:" %%A in ("%%O") do set "%%A=%%~B"
 
 :genn_option
@@ -79,6 +80,10 @@ if defined -d (
         set "BACKEND_PROJECT=single_threaded_cpu_backend"
         set "MACROS=%MACROS% /p:Configuration=Debug"
         set GENERATOR=.\generator_Debug.exe
+    ) else if defined -t (
+        set "BACKEND_PROJECT=multi_threaded_cpu_backend"
+        set "MACROS=%MACROS% /p:Configuration=Debug_MultiThreadedCPU"
+        set GENERATOR=.\generator_Debug_MultiThreadedCPU.exe
     ) else (
         if defined -l (
             set "BACKEND_PROJECT=opencl_backend"
@@ -97,6 +102,10 @@ if defined -d (
         set "BACKEND_PROJECT=single_threaded_cpu_backend"
         set "MACROS=%MACROS% /p:Configuration=Release"
         set GENERATOR=.\generator_Release.exe
+    ) else if defined -t (
+        set "BACKEND_PROJECT=multi_threaded_cpu_backend"
+        set "MACROS=%MACROS% /p:Configuration=Release_MultiThreadedCPU"
+        set GENERATOR=.\generator_Release_MultiThreadedCPU.exe
     ) else ( 
         if defined -l (
             set "BACKEND_PROJECT=opencl_backend"
@@ -309,6 +309,10 @@ def generateNumpyApplyArgoutviewArray1D( dataType, varName, sizeName ):
     '''Generates a line which applies numpy ARGOUTVIEW_ARRAY1 typemap to variable. ARGOUTVIEW_ARRAY1 gives access to C array via numpy array.'''
     return Template( '%apply ( ${data_t}* ARGOUTVIEW_ARRAY1, int* DIM1 ) {( ${data_t}* ${varName}, int* ${sizeName} )};\n').substitute( data_t=dataType, varName=varName, sizeName=sizeName )
 
+def generateNumpyApplyArgoutviewManagedArray1D( dataType, varName, sizeName ):
+    '''Generates a line which applies numpy ARGOUTVIEWM_ARRAY1 typemap to variable. ARGOUTVIEWM_ARRAY1 passes ownership of malloced C array to numpy array.'''
+    return Template( '%apply ( ${data_t}* ARGOUTVIEWM_ARRAY1, int* DIM1 ) {( ${data_t}* ${varName}, int* ${sizeName} )};\n').substitute( data_t=dataType, varName=varName, sizeName=sizeName )
+
 def generateNumpyApplyInArray1D( dataType, varName, sizeName ):
     '''Generates a line which applies numpy IN_ARRAY1 typemap to variable. IN_ARRAY1 is used to pass a numpy array as C array to C code'''
     return Template( '%apply ( ${data_t} IN_ARRAY1, int DIM1 ) {( ${data_t} ${varName}, int ${sizeName} )};\n').substitute( data_t=dataType, varName=varName, sizeName=sizeName )
@@ -346,6 +350,11 @@ def generateSharedLibraryModelInterface( swigPath ):
         mg.write( generateNumpyApplyInArray1D( 'double*', '_g', 'nG' ) )
         mg.write( generateNumpyApplyInArray1D( 'float*', '_g', 'nG' ) )
 
+        # Spike recording decoder reads recording words and returns newly-allocated id and offset arrays
+        mg.write( generateNumpyApplyInArray1D( 'unsigned int*', 'recordingWords', 'numRecordingWords' ) )
+        mg.write( generateNumpyApplyArgoutviewManagedArray1D( 'unsigned int*', 'ids', 'numIDs' ) )
+        mg.write( generateNumpyApplyArgoutviewManagedArray1D( 'unsigned int*', 'timestepOffsets', 'numTimestepOffsets' ) )
+
         mg.addSwigEnableUnderCaseConvert()
         mg.addSwigInclude( '"../../../userproject/include/sharedLibraryModel.h"' )
         mg.addSwigInclude( '"sharedLibraryModelNumpy.h"' )
@@ -623,7 +632,7 @@ def generateConfigs(gennPath, backends):
             #else
                 // Create makefile to compile and link all generated modules
                 std::ofstream makefile((outputPath / "Makefile").str());
-                CodeGenerator::generateMakefile(makefile, backend, output.first);
+                CodeGenerator::generateMakefile(makefile, model, backend, output.first);
             #endif
                 return output.second;
             }
@@ -219,6 +219,8 @@ public:
 
     virtual void genVariablePush(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, bool autoInitialized, size_t count) const override;
     virtual void genVariablePull(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, size_t count) const override;
+    virtual void genVariableRangePull(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc,
+                                      const std::string &offset, const std::string &count) const override;
 
     virtual void genCurrentVariablePush(CodeStream &os, const NeuronGroupInternal &ng, const std::string &type, 
                                         const std::string &name, VarLocation loc, unsigned int batchSize) const override;
@@ -0,0 +1,89 @@
+#pragma once
+
+// Standard C++ includes
+#include <string>
+
+// GeNN includes
+#include "backendExport.h"
+
+// Single-threaded CPU backend includes
+#include "../single_threaded_cpu/backend.h"
+
+//--------------------------------------------------------------------------
+// CodeGenerator::MultiThreadedCPU::Preferences
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace MultiThreadedCPU
+{
+//! Preferences for multi-threaded CPU backend
+struct Preferences : public SingleThreadedCPU::Preferences
+{
+    //! Number of OpenMP threads to use for simulation. If zero, the OpenMP default
+    //! (typically controlled by the OMP_NUM_THREADS environment variable) is used
+    unsigned int numThreads = 0;
+
+    void updateHash(boost::uuids::detail::sha1 &hash) const
+    {
+        // Superclass
+        SingleThreadedCPU::Preferences::updateHash(hash);
+
+        //! Update hash with preferences
+        Utils::updateHash(numThreads, hash);
+    }
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::MultiThreadedCPU::Backend
+//--------------------------------------------------------------------------
+//! Backend which generates the same code as the single-threaded CPU backend but uses
+//! OpenMP to split neuron, synapse and custom update loops across a pool of threads
+class BACKEND_EXPORT Backend : public SingleThreadedCPU::Backend
+{
+public:
+    Backend(const std::string &scalarType, const Preferences &preferences)
+    :   SingleThreadedCPU::Backend(scalarType, preferences)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // CodeGenerator::BackendBase virtuals
+    //--------------------------------------------------------------------------
+    virtual void genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genAllocateMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged, const MemAlloc &memAlloc) const override;
+
+    virtual void genMakefilePreamble(std::ostream &os) const override;
+    virtual void genMSBuildItemDefinitions(std::ostream &os) const override;
+
+    //! Get hash digest of this backends identification and the preferences it has been configured with
+    virtual boost::uuids::detail::sha1::digest_type getHashDigest() const override;
+
+    //--------------------------------------------------------------------------
+    // CodeGenerator::SingleThreadedCPU::Backend public virtuals
+    //--------------------------------------------------------------------------
+    virtual void genParallelForPreamble(CodeStream &os) const override;
+
+    virtual std::string getAccumulateTemplate(const std::string &target) const override;
+
+protected:
+    //--------------------------------------------------------------------------
+    // CodeGenerator::SingleThreadedCPU::Backend virtuals
+    //--------------------------------------------------------------------------
+    virtual void genNeuronUpdateLoop(CodeStream &os, const NeuronUpdateGroupMerged &ng, unsigned int batchSize, 
+                                     const Substitutions &popSubs, Handler handler) const override;
+
+    virtual std::string getSpikeQueueWriteIndex(const NeuronUpdateGroupMerged &ng, unsigned int batchSize, bool trueSpike) const override;
+
+    virtual std::string getSharedIncrement(const std::string &target) const override;
+
+    virtual std::string getSharedBitSet(const std::string &target, const std::string &bits) const override;
+
+private:
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+    //! Generate code to move spikes emitted by a chunk of neurons to the end of those emitted by previous chunks
+    void genCompactChunkSpikes(CodeStream &os, const NeuronUpdateGroupMerged &ng, unsigned int batchSize, bool trueSpike) const;
+};
+}   // namespace MultiThreadedCPU
+}   // namespace CodeGenerator
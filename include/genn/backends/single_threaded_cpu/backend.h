@@ -3,7 +3,9 @@
 // Standard C++ includes
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 // GeNN includes
 #include "backendExport.h"
@@ -12,6 +14,9 @@
 // GeNN code generator includes
 #include "code_generator/backendBase.h"
 
+// Single-threaded CPU backend includes
+#include "presynapticUpdateStrategy.h"
+
 // Forward declarations
 namespace filesystem
 {
@@ -25,8 +30,41 @@ namespace CodeGenerator
 {
 namespace SingleThreadedCPU
 {
+//! Preferences for single-threaded CPU backend
 struct Preferences : public PreferencesBase
 {
+    //! Split neuron update loops into a loop which updates neuron state and flags which neurons
+    //! have spiked, followed by a loop which emits flagged spikes. Removing the data-dependent
+    //! spike emission from the update loop allows compilers to vectorise it.
+    bool enableSplitNeuronUpdate = false;
+
+    //! Initialise each row (or column) of sparse connectivity using its own counter-based random number
+    //! stream so that, where this doesn't introduce race conditions, rows (or columns) can be built in
+    //! parallel and the resultant connectivity doesn't depend on how many threads are used
+    bool enableParallelConnectivityInit = false;
+
+    //! Replace the global host RNG used by neuron simulation code and by per-neuron variable initialisation
+    //! with counter-based random number streams, keyed by group, neuron and timestep, so these can be run
+    //! in parallel and results are reproducible regardless of how many threads are used
+    bool enableCounterBasedRNG = false;
+
+    //! Pad the stride of sparse connectivity rows to a multiple of this many synapses so, for example, rows of
+    //! single-precision weights can start on 64-byte cache lines by setting this to 16. If this is greater than one,
+    //! spikes are processed in chunks of this many synapses and, if weight update model simulation code consists
+    //! solely of a call to $(addToInSyn, ...), the input from each chunk is calculated in a loop which can be vectorised
+    unsigned int sparseRowStrideAlignment = 1;
+
+    void updateHash(boost::uuids::detail::sha1 &hash) const
+    {
+        // Superclass
+        PreferencesBase::updateHash(hash);
+
+        //! Update hash with preferences
+        Utils::updateHash(enableSplitNeuronUpdate, hash);
+        Utils::updateHash(enableParallelConnectivityInit, hash);
+        Utils::updateHash(enableCounterBasedRNG, hash);
+        Utils::updateHash(sparseRowStrideAlignment, hash);
+    }
 };
 
 //--------------------------------------------------------------------------
@@ -93,12 +131,15 @@ public:
     virtual void genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
                                  const Substitutions &kernelSubs, Handler handler) const override;
     virtual void genSparseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const override;
+    virtual void genDeltaEncodedSparseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const override;
     virtual void genDenseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const override;
     virtual void genKernelSynapseVariableInit(CodeStream &os, const SynapseInitGroupMerged &sg, const Substitutions &kernelSubs, Handler handler) const final;
     virtual void genKernelCustomUpdateVariableInit(CodeStream &os, const CustomWUUpdateInitGroupMerged &cu, const Substitutions &kernelSubs, Handler handler) const final;
 
     virtual void genVariablePush(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, bool autoInitialized, size_t count) const override;
     virtual void genVariablePull(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, size_t count) const override;
+    virtual void genVariableRangePull(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc,
+                                      const std::string &offset, const std::string &count) const override;
     virtual void genCurrentVariablePush(CodeStream &os, const NeuronGroupInternal &ng, const std::string &type, 
                                         const std::string &name, VarLocation loc, unsigned int batchSize) const override;
     virtual void genCurrentVariablePull(CodeStream &os, const NeuronGroupInternal &ng, const std::string &type, 
@@ -144,6 +185,10 @@ public:
 
     virtual bool isPostsynapticRemapRequired() const override{ return true; }
 
+    virtual bool isPostsynapticGatherRequired(const SynapseGroupInternal &sg) const override;
+
+    virtual bool isDeltaEncodedSparseIndSupported() const override{ return true; }
+
     //! Backends which support batch-parallelism might require an additional host reduction phase after reduction kernels
     virtual bool isHostReductionRequired() const override { return false; }
 
@@ -160,13 +205,103 @@ public:
     //! Get hash digest of this backends identification and the preferences it has been configured with
     virtual boost::uuids::detail::sha1::digest_type getHashDigest() const override;
 
+    //--------------------------------------------------------------------------
+    // Public virtuals
+    //--------------------------------------------------------------------------
+    //! Generate any code required before a loop whose iterations only interact through accumulation functions
+    /*! Single-threaded CPU backend simply runs these loops serially */
+    virtual void genParallelForPreamble(CodeStream&) const{}
+
+    //! Get function template used to accumulate $(0) into a target shared between loop iterations e.g. inSyn
+    virtual std::string getAccumulateTemplate(const std::string &target) const{ return target + " += $(0)"; }
+
+    //--------------------------------------------------------------------------
+    // Public API
+    //--------------------------------------------------------------------------
+    //! Generate counter-based RNG stream identified by key and three stream words and standard distributions
+    //! which use it, substituting these for the global host RNG and standard distributions
+    void genCounterBasedRNGStream(CodeStream &os, Substitutions &subs, const std::string &precision, const std::string &name,
+                                  const std::string &key, const std::string &stream0, const std::string &stream1,
+                                  const std::string &stream2) const;
+
+    //! Do all synapse groups within merged group have the same row stride?
+    bool isRowStrideHomogeneous(const SynapseGroupMergedBase &sg) const;
+
+    //--------------------------------------------------------------------------
+    // Static API
+    //--------------------------------------------------------------------------
+    //! Can synaptic matrix rows be processed in parallel by this code without race conditions
+    //! (other than those on variables updated using accumulation functions)
+    static bool canProcessRowsInParallel(const SynapseGroupInternal &sg, const std::string &code);
+
+    //! Can synaptic matrix columns be processed in parallel by this code without race conditions
+    //! (other than those on variables updated using accumulation functions)
+    static bool canProcessColumnsInParallel(const SynapseGroupInternal &sg, const std::string &code);
+
+protected:
+    //--------------------------------------------------------------------------
+    // Protected virtuals
+    //--------------------------------------------------------------------------
+    //! Generate loop through neurons of a neuron update group, calling handler with $(id) substituted
+    virtual void genNeuronUpdateLoop(CodeStream &os, const NeuronUpdateGroupMerged &ng, unsigned int batchSize, 
+                                     const Substitutions &popSubs, Handler handler) const;
+
+    //! Get the expression used to index (and advance) spike queue when a neuron emits a spike or spike-like event
+    virtual std::string getSpikeQueueWriteIndex(const NeuronUpdateGroupMerged &ng, unsigned int batchSize, bool trueSpike) const;
+
+    //! Get expression which increments a counter shared between loop iterations and evaluates to its previous value
+    virtual std::string getSharedIncrement(const std::string &target) const{ return target + "++"; }
+
+    //! Get statement which sets bits in a word shared between loop iterations
+    virtual std::string getSharedBitSet(const std::string &target, const std::string &bits) const{ return target + " |= " + bits; }
+
+    //--------------------------------------------------------------------------
+    // Protected API
+    //--------------------------------------------------------------------------
+    //! Get expression for the count of spikes or spike-like events emitted by current batch of neuron update group
+    std::string getSpikeCount(const NeuronUpdateGroupMerged &ng, unsigned int batchSize, bool trueSpike) const;
+
+    //! Get offset into spike or spike-like event array where current batch of neuron update group writes
+    std::string getSpikeQueueOffset(const NeuronUpdateGroupMerged &ng, unsigned int batchSize, bool trueSpike) const;
+
+    //! Generate loop through range of neurons of a neuron update group, calling handler with $(id) substituted
+    /*! If split neuron update is enabled, this loop only flags spiking neurons
+        and a second loop through the range emits their spikes */
+    void genNeuronUpdateRange(CodeStream &os, const NeuronUpdateGroupMerged &ng, unsigned int batchSize, const Substitutions &popSubs,
+                              const std::string &start, const std::string &end, Handler handler) const;
+
 private:
     //--------------------------------------------------------------------------
     // Private methods
     //--------------------------------------------------------------------------
     void genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg, const Substitutions &popSubs, bool trueSpike) const;
 
-    void genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, bool trueSpike, bool recordingEnabled) const;
+    // Get appropriate presynaptic update strategy to use for this synapse group and type of presynaptic event
+    const PresynapticUpdateStrategy::Base *getPresynapticUpdateStrategy(const SynapseGroupInternal &sg, bool trueSpike) const;
+
+    void genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, unsigned int batchSize, bool trueSpike, bool recordingEnabled) const;
+
+    void genWriteSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const std::string &id, unsigned int batchSize, bool trueSpike) const;
+
+    void genRecordSpike(CodeStream &os, const std::string &id, unsigned int batchSize, bool trueSpike) const;
+
+    //! Generate postsynaptic learning code for one synapse, with $(id_pre) and $(id_syn) already substituted.
+    //! If sharedPreOutput is set, presynaptic output may be accumulated into by several iterations at once.
+    void genPostsynapticUpdateSynapse(CodeStream &os, const ModelSpecMerged &modelMerged, const PostsynapticUpdateGroupMerged &sg,
+                                      Substitutions &synSubs, unsigned int batchSize, bool sharedPreOutput) const;
+
+    //! Are counter-based RNG streams required to initialise any sparse connectivity?
+    bool isConnectivityInitRNGStreamRequired(const ModelSpecMerged &modelMerged) const;
+
+    //! Are counter-based RNG streams required to regenerate procedural connectivity?
+    bool isProceduralRNGStreamRequired(const ModelSpecMerged &modelMerged) const;
+
+    //! Are counter-based RNG streams required to replace global host RNG in simulation and variable initialisation?
+    bool isCounterBasedRNGRequired(const ModelSpecMerged &modelMerged) const;
+
+    //! If counter-based RNG streams are required for variable initialisation, generate counter of initialisation sites
+    //! within group and add it, alongside index of group across all merged init groups, to substitutions
+    void genInitRNGSiteCounter(CodeStream &os, Substitutions &popSubs, size_t initRNGGroupIndex) const;
 
     template<typename T>
     void genMergedStructArrayPush(CodeStream &os, const std::vector<T> &groups) const
@@ -196,11 +331,11 @@ private:
     }
 
     //! Helper to generate code to copy reduced custom update group variables back to memory
-    /*! Because reduction operations are unnecessary in unbatched single-threaded CPU models so there's no need to actually reduce */
+    /*! Used by custom updates which aren't batch reductions, where each element is reduced into by a single iteration so there's no need to actually reduce */
     void genWriteBackReductions(CodeStream &os, const CustomUpdateGroupMerged &cg, const std::string &idx) const;
 
     //! Helper to generate code to copy reduced custom weight update group variables back to memory
-    /*! Because reduction operations are unnecessary in unbatched single-threaded CPU models so there's no need to actually reduce */
+    /*! Used by custom updates which aren't batch reductions, where each element is reduced into by a single iteration so there's no need to actually reduce */
     void genWriteBackReductions(CodeStream &os, const CustomUpdateWUGroupMerged &cg, const std::string &idx) const;
 
     template<typename G, typename R>
@@ -227,6 +362,11 @@ private:
             }
         }
     }
+
+    //--------------------------------------------------------------------------
+    // Static members
+    //--------------------------------------------------------------------------
+    static const std::vector<std::unique_ptr<PresynapticUpdateStrategy::Base>> s_PresynapticUpdateStrategies;
 };
 }   // namespace SingleThreadedCPU
 }   // namespace CodeGenerator
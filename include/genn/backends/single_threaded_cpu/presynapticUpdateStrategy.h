@@ -0,0 +1,207 @@
+#pragma once
+
+// GeNN code generator includes
+#include "code_generator/backendBase.h"
+
+// Forward declarations
+class SynapseGroupInternal;
+
+namespace CodeGenerator
+{
+class ModelSpecMerged;
+
+namespace SingleThreadedCPU
+{
+class Backend;
+struct Preferences;
+}
+}
+
+//--------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::Base
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace SingleThreadedCPU
+{
+namespace PresynapticUpdateStrategy
+{
+class Base
+{
+public:
+    //------------------------------------------------------------------------
+    // Declared virtuals
+    //------------------------------------------------------------------------
+    //! Is this presynaptic update strategy compatible with a given synapse group and type of presynaptic event?
+    virtual bool isCompatible(const SynapseGroupInternal &sg, const Preferences &preferences, bool trueSpike) const = 0;
+
+    //! Generate presynaptic update code
+    virtual void genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                           const Substitutions &popSubs, const Backend &backend, bool trueSpike) const = 0;
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::RowScatter
+//--------------------------------------------------------------------------
+//! Loops through the rows of spiking presynaptic neurons, scattering input to each postsynaptic neuron
+/*! Used for sparse, dense and bitmask connectivity */
+class RowScatter : public Base
+{
+public:
+    //------------------------------------------------------------------------
+    // PresynapticUpdateStrategy::Base virtuals
+    //------------------------------------------------------------------------
+    //! Is this presynaptic update strategy compatible with a given synapse group and type of presynaptic event?
+    virtual bool isCompatible(const SynapseGroupInternal &sg, const Preferences &preferences, bool trueSpike) const override;
+
+    //! Generate presynaptic update code
+    virtual void genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                           const Substitutions &popSubs, const Backend &backend, bool trueSpike) const override;
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::RowScatterBitmask
+//--------------------------------------------------------------------------
+//! Loops through the rows of spiking presynaptic neurons, finding synapses in each word of bitmask using CLZ
+/*! Used for bitmask connectivity when bitmask optimisations are enabled */
+class RowScatterBitmask : public Base
+{
+public:
+    //------------------------------------------------------------------------
+    // PresynapticUpdateStrategy::Base virtuals
+    //------------------------------------------------------------------------
+    //! Is this presynaptic update strategy compatible with a given synapse group and type of presynaptic event?
+    virtual bool isCompatible(const SynapseGroupInternal &sg, const Preferences &preferences, bool trueSpike) const override;
+
+    //! Generate presynaptic update code
+    virtual void genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                           const Substitutions &popSubs, const Backend &backend, bool trueSpike) const override;
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::RowScatterProcedural
+//--------------------------------------------------------------------------
+//! Regenerates the rows of spiking presynaptic neurons, scattering input to each postsynaptic neuron
+/*! Used for procedural connectivity */
+class RowScatterProcedural : public Base
+{
+public:
+    //------------------------------------------------------------------------
+    // PresynapticUpdateStrategy::Base virtuals
+    //------------------------------------------------------------------------
+    //! Is this presynaptic update strategy compatible with a given synapse group and type of presynaptic event?
+    virtual bool isCompatible(const SynapseGroupInternal &sg, const Preferences &preferences, bool trueSpike) const override;
+
+    //! Generate presynaptic update code
+    virtual void genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                           const Substitutions &popSubs, const Backend &backend, bool trueSpike) const override;
+
+    //------------------------------------------------------------------------
+    // Static API
+    //------------------------------------------------------------------------
+    //! Does regenerating procedural connectivity (and any procedural weights generated alongside it) require an RNG?
+    static bool isRNGRequired(const SynapseGroupInternal &sg);
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::RowScatterVectorised
+//--------------------------------------------------------------------------
+//! Loops through the rows of spiking presynaptic neurons in chunks, calculating the input from each chunk
+//! of synapses in a fixed-length loop which can be vectorised and then scattering it to postsynaptic neurons
+/*! Used for sparse connectivity when sparse row stride alignment is enabled and weight
+    update model simulation code consists solely of a call to $(addToInSyn, ...) */
+class RowScatterVectorised : public Base
+{
+public:
+    //------------------------------------------------------------------------
+    // PresynapticUpdateStrategy::Base virtuals
+    //------------------------------------------------------------------------
+    //! Is this presynaptic update strategy compatible with a given synapse group and type of presynaptic event?
+    virtual bool isCompatible(const SynapseGroupInternal &sg, const Preferences &preferences, bool trueSpike) const override;
+
+    //! Generate presynaptic update code
+    virtual void genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                           const Substitutions &popSubs, const Backend &backend, bool trueSpike) const override;
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::RowScatterDeltaEncoded
+//--------------------------------------------------------------------------
+//! Loops through the rows of spiking presynaptic neurons, decoding the index of each postsynaptic neuron
+//! from the delta-encoded row and scattering input to it
+/*! Used for sparse connectivity with delta-encoded sparse indices */
+class RowScatterDeltaEncoded : public Base
+{
+public:
+    //------------------------------------------------------------------------
+    // PresynapticUpdateStrategy::Base virtuals
+    //------------------------------------------------------------------------
+    //! Is this presynaptic update strategy compatible with a given synapse group and type of presynaptic event?
+    virtual bool isCompatible(const SynapseGroupInternal &sg, const Preferences &preferences, bool trueSpike) const override;
+
+    //! Generate presynaptic update code
+    virtual void genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                           const Substitutions &popSubs, const Backend &backend, bool trueSpike) const override;
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::Toeplitz
+//--------------------------------------------------------------------------
+//! Loops through the diagonals of a Toeplitz matrix, applying each to all spiking presynaptic neurons
+/*! Used for Toeplitz connectivity */
+class Toeplitz : public Base
+{
+public:
+    //------------------------------------------------------------------------
+    // PresynapticUpdateStrategy::Base virtuals
+    //------------------------------------------------------------------------
+    //! Is this presynaptic update strategy compatible with a given synapse group and type of presynaptic event?
+    virtual bool isCompatible(const SynapseGroupInternal &sg, const Preferences &preferences, bool trueSpike) const override;
+
+    //! Generate presynaptic update code
+    virtual void genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                           const Substitutions &popSubs, const Backend &backend, bool trueSpike) const override;
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::TiledDense
+//--------------------------------------------------------------------------
+//! Loops through tiles of postsynaptic neurons, accumulating the input from all spiking presynaptic neurons to each tile
+/*! Used for dense connectivity with tiled dense update enabled and weight update
+    model simulation code which consists solely of a call to $(addToInSyn, ...) */
+class TiledDense : public Base
+{
+public:
+    //------------------------------------------------------------------------
+    // PresynapticUpdateStrategy::Base virtuals
+    //------------------------------------------------------------------------
+    //! Is this presynaptic update strategy compatible with a given synapse group and type of presynaptic event?
+    virtual bool isCompatible(const SynapseGroupInternal &sg, const Preferences &preferences, bool trueSpike) const override;
+
+    //! Generate presynaptic update code
+    virtual void genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                           const Substitutions &popSubs, const Backend &backend, bool trueSpike) const override;
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::ColumnGather
+//--------------------------------------------------------------------------
+//! Flags spiking presynaptic neurons in a bitmask and then loops through the columns of each postsynaptic
+//! neuron, using the postsynaptic remapping data structure, gathering input from the flagged presynaptic neurons
+/*! Used for sparse connectivity with postsynaptic gather enabled */
+class ColumnGather : public Base
+{
+public:
+    //------------------------------------------------------------------------
+    // PresynapticUpdateStrategy::Base virtuals
+    //------------------------------------------------------------------------
+    //! Is this presynaptic update strategy compatible with a given synapse group and type of presynaptic event?
+    virtual bool isCompatible(const SynapseGroupInternal &sg, const Preferences &preferences, bool trueSpike) const override;
+
+    //! Generate presynaptic update code
+    virtual void genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                           const Substitutions &popSubs, const Backend &backend, bool trueSpike) const override;
+};
+}   // namespace PresynapticUpdateStrategy
+}   // namespace SingleThreadedCPU
+}   // namespace CodeGenerator
@@ -281,6 +281,7 @@ public:
     virtual void genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
                                  const Substitutions &kernelSubs, Handler handler) const = 0;
     virtual void genSparseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const = 0;
+    virtual void genDeltaEncodedSparseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const = 0;
     virtual void genDenseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const = 0;
     virtual void genKernelSynapseVariableInit(CodeStream &os, const SynapseInitGroupMerged &sg, const Substitutions &kernelSubs, Handler handler) const = 0;
     virtual void genKernelCustomUpdateVariableInit(CodeStream &os, const CustomWUUpdateInitGroupMerged &cu, const Substitutions &kernelSubs, Handler handler) const = 0;
@@ -291,6 +292,11 @@ public:
     //! Generate code for pulling a variable from the 'device'
     virtual void genVariablePull(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, size_t count) const = 0;
 
+    //! Generate code for pulling a contiguous range of a variable from the 'device'
+    /*! offset and count are expressions evaluated in the generated code */
+    virtual void genVariableRangePull(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc,
+                                      const std::string &offset, const std::string &count) const = 0;
+
     //! Generate code for pushing a variable's value in the current timestep to the 'device'
     virtual void genCurrentVariablePush(CodeStream &os, const NeuronGroupInternal &ng, const std::string &type, 
                                         const std::string &name, VarLocation loc, unsigned int batchSize) const = 0;
@@ -386,6 +392,13 @@ public:
     //! Different backends may implement synaptic plasticity differently. Does this one require a postsynaptic remapping data structure?
     virtual bool isPostsynapticRemapRequired() const = 0;
 
+    //! Different backends may implement presynaptic updates differently. Does this one gather synaptic input to the
+    //! postsynaptic neurons of this synapse group using the postsynaptic remapping data structure?
+    virtual bool isPostsynapticGatherRequired(const SynapseGroupInternal&) const{ return false; }
+
+    //! Can this backend store the indices of sparse connectivity as variable-byte encoded deltas?
+    virtual bool isDeltaEncodedSparseIndSupported() const{ return false; }
+
     //! Backends which support batch-parallelism might require an additional host reduction phase after reduction kernels
     virtual bool isHostReductionRequired() const = 0;
 
@@ -446,6 +459,10 @@ public:
 
     bool areSixtyFourBitSynapseIndicesRequired(const SynapseGroupMergedBase &sg) const;
 
+    //! Does this synapse group require a postsynaptic remapping data structure,
+    //! either for postsynaptic learning or to gather synaptic input?
+    bool isSynapseGroupPostsynapticRemapRequired(const SynapseGroupInternal &sg) const;
+
     const PreferencesBase &getPreferences() const { return m_Preferences; }
 
     template<typename T>
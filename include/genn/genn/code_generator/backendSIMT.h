@@ -129,6 +129,11 @@ public:
         genSynapseVariableRowInit(os, kernelSubs, handler);
     }
 
+    virtual void genDeltaEncodedSparseSynapseVariableRowInit(CodeStream&, const Substitutions&, Handler) const final
+    {
+        throw std::runtime_error("Delta-encoded sparse indices are not supported by SIMT backends");
+    }
+
     virtual void genDenseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const final
     {
         genSynapseVariableRowInit(os, kernelSubs, handler);
@@ -31,13 +31,37 @@ namespace CodeGenerator
 GENN_EXPORT void substitute(std::string &s, const std::string &trg, const std::string &rep);
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting variable  names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting variable names in the neuron code strings or other templates
 //--------------------------------------------------------------------------
+GENN_EXPORT bool varSubstitute(std::string &s, const std::string &trg, const std::string &rep);
+
+//--------------------------------------------------------------------------
+//! \brief Tool for substituting all variable names found in a map in a single pass over the code
+//--------------------------------------------------------------------------
+GENN_EXPORT bool varSubstitute(std::string &s, const std::unordered_map<std::string, std::string> &substitutions);
+
+//--------------------------------------------------------------------------
+//! \brief Tool for substituting function names in the neuron code strings or other templates
+//--------------------------------------------------------------------------
+GENN_EXPORT bool funcSubstitute(std::string &s, const std::string &trg, const std::string &rep);
+
+//--------------------------------------------------------------------------
+//! \brief Tool for substituting all function names found in a map in a single pass over the code
+//--------------------------------------------------------------------------
+GENN_EXPORT bool funcSubstitute(std::string &s, const std::unordered_map<std::string, std::string> &substitutions);
+
+//--------------------------------------------------------------------------
+//! \brief Tool for substituting variable names in the neuron code strings or other templates
+//! \deprecated Use varSubstitute instead
+//--------------------------------------------------------------------------
+[[deprecated("Use varSubstitute instead")]]
 GENN_EXPORT bool regexVarSubstitute(std::string &s, const std::string &trg, const std::string &rep);
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting function names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting function names in the neuron code strings or other templates
+//! \deprecated Use funcSubstitute instead
 //--------------------------------------------------------------------------
+[[deprecated("Use funcSubstitute instead")]]
 GENN_EXPORT bool regexFuncSubstitute(std::string &s, const std::string &trg, const std::string &rep);
 
 //--------------------------------------------------------------------------
@@ -96,6 +120,13 @@ GENN_EXPORT void checkUnreplacedVariables(const std::string &code, const std::st
  //--------------------------------------------------------------------------
 GENN_EXPORT std::string disambiguateNamespaceFunction(const std::string supportCode, const std::string code, std::string namespaceName);
 
+//--------------------------------------------------------------------------
+/*! \brief This function writes generated code to a file if it differs from the file's current contents.
+    Leaving unchanged files untouched preserves their timestamps so build systems don't recompile them.
+ */
+ //--------------------------------------------------------------------------
+GENN_EXPORT void writeFileIfChanged(const std::string &filename, const std::string &contents);
+
 //-------------------------------------------------------------------------
 /*!
   \brief Function for performing the code and value substitutions necessary to insert neuron related variables, parameters, and extraGlobal parameters into synaptic code.
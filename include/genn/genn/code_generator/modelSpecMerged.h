@@ -208,6 +208,18 @@ public:
     //! Get hash digest of init module
     boost::uuids::detail::sha1::digest_type getInitArchetypeHashDigest() const;
 
+    //! Get hash digest of everything used to generate neuron update module
+    boost::uuids::detail::sha1::digest_type getNeuronUpdateModuleHashDigest(const BackendBase &backend) const;
+
+    //! Get hash digest of everything used to generate synapse update module
+    boost::uuids::detail::sha1::digest_type getSynapseUpdateModuleHashDigest(const BackendBase &backend) const;
+
+    //! Get hash digest of everything used to generate custom update module
+    boost::uuids::detail::sha1::digest_type getCustomUpdateModuleHashDigest(const BackendBase &backend) const;
+
+    //! Get hash digest of everything used to generate init module
+    boost::uuids::detail::sha1::digest_type getInitModuleHashDigest(const BackendBase &backend) const;
+
     //! Does model have any EGPs?
     bool anyPointerEGPs() const;
 
@@ -299,6 +311,28 @@ private:
         }
     }
 
+    //! Update hash with properties of model and backend which effect all modules
+    void updateModuleHash(boost::uuids::detail::sha1 &hash, const BackendBase &backend) const;
+
+    //! Update hash with hash digests and memory spaces of merged groups
+    template<typename T>
+    void updateMergedGroupsHash(boost::uuids::detail::sha1 &hash, const std::vector<T> &mergedGroups) const
+    {
+        for(const auto &g : mergedGroups) {
+            Utils::updateHash(g.getHashDigest(), hash);
+            Utils::updateHash(g.getMemorySpace(), hash);
+        }
+    }
+
+    //! Update hash with memory spaces of merged groups whose properties are included in other merged groups' digests
+    template<typename T>
+    void updateMergedGroupsMemorySpaceHash(boost::uuids::detail::sha1 &hash, const std::vector<T> &mergedGroups) const
+    {
+        for(const auto &g : mergedGroups) {
+            Utils::updateHash(g.getMemorySpace(), hash);
+        }
+    }
+
     template<typename Group, typename MergedGroup, typename D>
     void createMergedGroupsHash(const ModelSpecInternal &model, const BackendBase &backend,
                                 const std::vector<std::reference_wrapper<const Group>> &unmergedGroups,
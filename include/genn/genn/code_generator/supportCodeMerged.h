@@ -68,6 +68,15 @@ public:
     //! Gets the number of support code strings hence namespaces which will be generated
     size_t getNumSupportCodeString() const{ return m_SupportCode.size(); }
 
+    //! Update hash with support code strings and the names of the namespaces they will be generated in
+    void updateHash(boost::uuids::detail::sha1 &hash) const
+    {
+        for(const auto &s : m_SupportCode) {
+            Utils::updateHash(s.first, hash);
+            Utils::updateHash(s.second, hash);
+        }
+    }
+
 private:
     //------------------------------------------------------------------------
     // Members
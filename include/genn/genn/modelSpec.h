@@ -284,6 +284,12 @@ public:
 
     void setBatchSize(unsigned int batchSize) { m_BatchSize = batchSize;  }
 
+    //! Set how many host buffers are used to hand completed windows of spike recording data to a user callback
+    /*! If this is non-zero, the generated code provides setRecordingCallback and flushRecordingBuffers functions.
+        Each time the simulation fills the recording buffer, it is copied into a free host buffer and passed
+        to the callback on a background thread so the simulation can continue while data is written to disk */
+    void setNumAsyncRecordingBuffers(unsigned int numBuffers){ m_NumAsyncRecordingBuffers = numBuffers; }
+
     //! Gets the name of the neuronal network model
     const std::string &getName() const{ return m_Name; }
 
@@ -304,6 +310,9 @@ public:
 
     unsigned int getBatchSize() const { return m_BatchSize;  }
 
+    //! How many host buffers are used to asynchronously hand recording data to a user callback
+    unsigned int getNumAsyncRecordingBuffers() const { return m_NumAsyncRecordingBuffers; }
+
     // PUBLIC NEURON FUNCTIONS
     //========================
     //! How many neurons make up the entire model
@@ -926,6 +935,9 @@ private:
 
     //! Batch size of this model - efficiently duplicates model
     unsigned int m_BatchSize;
+
+    //! Number of host buffers used to asynchronously hand recording data to a user callback (0 disables)
+    unsigned int m_NumAsyncRecordingBuffers;
 };
 
 // Typedefine NNmodel for backward compatibility
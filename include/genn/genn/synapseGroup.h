@@ -114,6 +114,27 @@ public:
     //! Enables or disables using narrow i.e. less than 32-bit types for sparse matrix indices
     void setNarrowSparseIndEnabled(bool enabled);
 
+    //! Enables or disables processing incoming spikes in tiles of postsynaptic neurons on CPU
+    /*! Rather than scattering each spike along a whole row of the dense matrix, CPU backends loop through tiles of
+        postsynaptic neurons and, within each tile, accumulate the input from all spikes. This is faster when a large
+        fraction of the presynaptic population spikes every timestep but is only used if the weight update model's
+        simulation code consists solely of a call to \$(addToInSyn, ...) */
+    void setTiledDenseUpdateEnabled(bool enabled);
+
+    //! Enables or disables gathering incoming spikes to each postsynaptic neuron on CPU
+    /*! Rather than scattering each spike along its row of the sparse matrix, CPU backends flag the presynaptic neurons which
+        spiked this timestep and, for each postsynaptic neuron, sum the input from the flagged neurons in its column. This
+        means each postsynaptic neuron's input is only updated by a single thread but, as every synapse is visited each
+        timestep, it is only faster when a large fraction of the presynaptic population spikes every timestep */
+    void setPostsynapticGatherEnabled(bool enabled);
+
+    //! Enables or disables storing sparse matrix indices as variable-byte encoded deltas on CPU
+    /*! Rather than storing the index of each synapse's postsynaptic neuron, CPU backends store the difference
+        between it and the previous index in the row using as few bytes as possible and decode them on the fly.
+        This requires rows to be built in ascending order by a connectivity initialisation snippet with row building
+        code and means that connectivity cannot be accessed from the host or by custom weight updates */
+    void setDeltaEncodedSparseIndEnabled(bool enabled);
+
     //------------------------------------------------------------------------
     // Public const methods
     //------------------------------------------------------------------------
@@ -121,8 +142,11 @@ public:
 
     SpanType getSpanType() const{ return m_SpanType; }
     unsigned int getNumThreadsPerSpike() const{ return m_NumThreadsPerSpike; }
+    bool isTiledDenseUpdateEnabled() const{ return m_TiledDenseUpdateEnabled; }
     unsigned int getDelaySteps() const{ return m_DelaySteps; }
     unsigned int getBackPropDelaySteps() const{ return m_BackPropDelaySteps; }
+    bool isPostsynapticGatherEnabled() const;
+    bool isDeltaEncodedSparseIndEnabled() const;
     unsigned int getMaxConnections() const;
     unsigned int getMaxSourceConnections() const;
     unsigned int getMaxDendriticDelayTimesteps() const{ return m_MaxDendriticDelayTimesteps; }
@@ -166,6 +190,10 @@ public:
     /*! NOTE: this can only be called after model is finalized but needs to be public for PyGeNN */
     std::string getSparseIndType() const;
 
+    //! Get the maximum number of bytes required to store a row of delta-encoded sparse matrix indices
+    /*! NOTE: this can only be called after model is finalized */
+    size_t getMaxDeltaEncodedRowBytes() const;
+
     const WeightUpdateModels::Base *getWUModel() const{ return m_WUModel; }
 
     const std::vector<double> &getWUParams() const{ return m_WUParams; }
@@ -413,6 +441,15 @@ private:
     //! How many threads CUDA implementation uses to process each spike when span type is PRESYNAPTIC
     unsigned int m_NumThreadsPerSpike;
 
+    //! Should CPU implementation process incoming spikes in tiles of postsynaptic neurons
+    bool m_TiledDenseUpdateEnabled;
+
+    //! Should CPU implementation gather incoming spikes to each postsynaptic neuron
+    bool m_PostsynapticGatherEnabled;
+
+    //! Should CPU implementation store sparse matrix indices as variable-byte encoded deltas
+    bool m_DeltaEncodedSparseIndEnabled;
+
     //! Global synaptic conductance delay for the group (in time steps)
     unsigned int m_DelaySteps;
 
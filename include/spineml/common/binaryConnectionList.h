@@ -0,0 +1,87 @@
+#pragma once
+
+// Standard C++ includes
+#include <functional>
+#include <string>
+#include <vector>
+
+// Standard C includes
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+//----------------------------------------------------------------------------
+// SpineMLCommon::BinaryConnectionList
+//----------------------------------------------------------------------------
+//! Read-only, memory-mapped view of a SpineML binary connection list file
+/*! Each synapse is stored as a 32-bit presynaptic index, a 32-bit postsynaptic index and,
+    if the list has explicit delays, a single-precision delay in ms */
+namespace SpineMLCommon
+{
+class BinaryConnectionList
+{
+public:
+    //------------------------------------------------------------------------
+    // Summary
+    //------------------------------------------------------------------------
+    //! Summary of connectivity, calculated by scanning file
+    struct Summary
+    {
+        unsigned int maxRowLength;
+        bool heterogeneousDelay;
+        float maxDelayMs;
+    };
+
+    BinaryConnectionList(const std::string &filename, unsigned int numConnections, bool explicitDelay);
+    ~BinaryConnectionList();
+
+    BinaryConnectionList(const BinaryConnectionList&) = delete;
+    BinaryConnectionList &operator = (const BinaryConnectionList&) = delete;
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    unsigned int getNumConnections() const{ return m_NumConnections; }
+    bool hasExplicitDelay() const{ return (m_WordsPerSynapse == 3); }
+
+    uint32_t getPre(size_t i) const{ return m_Words[i * m_WordsPerSynapse]; }
+    uint32_t getPost(size_t i) const{ return m_Words[(i * m_WordsPerSynapse) + 1]; }
+    float getDelay(size_t i) const
+    {
+        float delay;
+        std::memcpy(&delay, &m_Words[(i * m_WordsPerSynapse) + 2], sizeof(float));
+        return delay;
+    }
+
+    //! Get summary of connectivity with numPre rows by scanning connection list in parallel
+    Summary getSummary(unsigned int numPre) const;
+
+    //! Call func(begin, end) on ranges of synapses in parallel, returning once all calls have completed
+    void parallelFor(std::function<void(size_t, size_t)> func) const;
+
+    //! Call func(begin, end) on ranges of the numRows rows built from this list in parallel, returning once all calls have completed
+    void parallelForRows(unsigned int numRows, std::function<void(size_t, size_t)> func) const;
+
+private:
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    //! Call func(begin, end) on ranges of numItems items, in parallel if connection list is large enough to benefit
+    void parallelFor(size_t numItems, std::function<void(size_t, size_t)> func) const;
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    const std::string m_Filename;
+    const unsigned int m_NumConnections;
+    const unsigned int m_WordsPerSynapse;
+
+    //! Pointer to mapped file
+    const uint32_t *m_Words;
+
+#ifdef _WIN32
+    void *m_File;
+    void *m_Mapping;
+#endif
+};
+}   // namespace SpineMLCommon
@@ -5,6 +5,10 @@
 #include <map>
 #include <memory>
 #include <random>
+#include <vector>
+
+// Standard C includes
+#include <cstdint>
 
 // Forward declarations
 namespace pugi
@@ -127,10 +131,39 @@ protected:
     virtual double getTimeToSpike(double isiMs) = 0;
 
 private:
+    //----------------------------------------------------------------------------
+    // Private API
+    //----------------------------------------------------------------------------
+    //! Schedule neuron to spike once its time to spike, starting at timestep, reaches zero
+    /*! timesteps are counted only while input is applied */
+    void scheduleSpike(unsigned int neuronID, double timeToSpike, unsigned long long timestep, double dt);
+
     //----------------------------------------------------------------------------
     // Members
     //----------------------------------------------------------------------------
-    std::map<unsigned int, std::pair<double, double>> m_TimeToSpike;
+    //! Interspike interval of each neuron
+    std::vector<double> m_ISI;
+
+    //! Time to spike each neuron will have at the timestep it is scheduled to spike
+    /*! **NOTE** this is zero or negative and is carried over so sub-timestep remainders don't get ignored */
+    std::vector<double> m_TimeToSpike;
+
+    //! Timestep each neuron is scheduled to spike at
+    std::vector<unsigned long long> m_SpikeTimestep;
+
+    //! Incremented whenever neuron is rescheduled or turned off so stale entries in calendar queue can be identified
+    std::vector<uint32_t> m_Generation;
+
+    //! Calendar queue containing neuron ID and generation of scheduled spikes
+    /*! Spikes are placed in bucket corresponding to timestep modulo number of buckets so,
+        each timestep, only one bucket needs to be searched rather than the whole population */
+    std::vector<std::vector<std::pair<unsigned int, uint32_t>>> m_CalendarQueue;
+
+    //! Number of timesteps input has been applied for
+    unsigned long long m_NumAppliedTimesteps;
+
+    //! Neurons spiking in current timestep
+    std::vector<unsigned int> m_SpikingNeurons;
 };
 
 //----------------------------------------------------------------------------
@@ -9,6 +9,7 @@
 
 // Simulator includes
 #include "networkClient.h"
+#include "networkIO.h"
 
 // Forward declarations
 namespace pugi
@@ -211,7 +212,7 @@ private:
 class ExternalNetwork : public External
 {
 public:
-    ExternalNetwork(double dt, unsigned int numNeurons, const pugi::xml_node &node);
+    ExternalNetwork(double dt, unsigned int numNeurons, const pugi::xml_node &node, NetworkIO &networkIO);
 
 protected:
     //------------------------------------------------------------------------
@@ -230,7 +231,7 @@ private:
 // Functions
 //----------------------------------------------------------------------------
 std::unique_ptr<Base> create(double dt, unsigned int numNeurons, const pugi::xml_node &node,
-                             std::map<std::string, InputValue::External*> &externalInputs);
+                             std::map<std::string, InputValue::External*> &externalInputs, NetworkIO &networkIO);
 
 }   // namespace InputValue
 }   // namespace SpineMLSimulator
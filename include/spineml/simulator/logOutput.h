@@ -1,14 +1,18 @@
 #pragma once
 
 // Standard C++ includes
-#include <fstream>
-#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
+// Standard C includes
+#include <cstdint>
+
 // SpineML simulator includes
+#include "logWriter.h"
 #include "modelProperty.h"
 #include "networkClient.h"
+#include "networkIO.h"
 
 // Forward declarations
 namespace pugi
@@ -40,6 +44,9 @@ public:
     // Record any data required during this timestep
     virtual void record(double dt, unsigned long long timestep) = 0;
 
+    // Record any data which has been buffered but not yet recorded when simulation ends after timestep
+    virtual void flush(double, unsigned long long){}
+
 protected:
     //----------------------------------------------------------------------------
     // Protected API
@@ -82,7 +89,8 @@ protected:
     //----------------------------------------------------------------------------
     // Protected API
     //----------------------------------------------------------------------------
-    void pullModelPropertyFromDevice() const{ m_ModelProperty->pullFromDevice(); }
+    // Pull the parts of the model property being logged from device
+    void pullModelPropertyFromDevice() const;
 
 private:
     //----------------------------------------------------------------------------
@@ -93,6 +101,9 @@ private:
 
     // Which members of population to log (all if empty)
     std::vector<unsigned int> m_Indices;
+
+    // Contiguous ranges of model property, covering indices, to pull from device (offset and count)
+    std::vector<std::pair<unsigned int, unsigned int>> m_PullRanges;
 };
 
 //----------------------------------------------------------------------------
@@ -103,7 +114,7 @@ class AnalogueFile : public AnalogueBase
 public:
     AnalogueFile(const pugi::xml_node &node, double dt, unsigned long long numTimeSteps,
                  const std::string &port, unsigned int popSize,
-                 const filesystem::path &logPath,
+                 const filesystem::path &logPath, LogWriter &logWriter,
                  const ModelProperty::Base *modelProperty);
 
     //----------------------------------------------------------------------------
@@ -116,7 +127,9 @@ private:
     //----------------------------------------------------------------------------
     // Members
     //----------------------------------------------------------------------------
-    std::ofstream m_File;
+    // Writer and handle of file data is written to
+    LogWriter &m_LogWriter;
+    unsigned int m_File;
 
     // Buffer used, if indices are in use, to store contiguous output data
     std::vector<scalar> m_OutputBuffer;
@@ -165,7 +178,7 @@ class AnalogueNetwork : public AnalogueExternal
 public:
     AnalogueNetwork(const pugi::xml_node &node, double dt,
                     const std::string &port, unsigned int popSize,
-                    const filesystem::path &logPath,
+                    const filesystem::path &logPath, NetworkIO &networkIO,
                     const ModelProperty::Base *modelProperty);
 
 protected:
@@ -193,9 +206,9 @@ class Event : public Base
 public:
     Event(const pugi::xml_node &node, double dt, unsigned long long numTimeSteps,
           const std::string &port, unsigned int popSize,
-          const filesystem::path &logPath, unsigned int *spikeQueuePtr,
-          unsigned int *hostSpikeCount, unsigned int *hostSpikes,
-          void (*pullCurrentSpikesFunc)(void));
+          const filesystem::path &logPath, LogWriter &logWriter, bool binary,
+          unsigned int *spikeQueuePtr, unsigned int *hostSpikeCount, unsigned int *hostSpikes,
+          void (*pullCurrentSpikesFunc)(void), uint32_t **recordSpk = nullptr, unsigned int numRecordingTimesteps = 0);
 
     //----------------------------------------------------------------------------
     // Base virtuals
@@ -203,11 +216,27 @@ public:
     // Record any data required during this timestep
     virtual void record(double dt, unsigned long long timestep) override;
 
+    // Record any data which has been buffered but not yet recorded when simulation ends after timestep
+    virtual void flush(double dt, unsigned long long timestep) override;
+
 private:
+    //----------------------------------------------------------------------------
+    // Private methods
+    //----------------------------------------------------------------------------
+    bool shouldLogIndex(unsigned int index) const
+    {
+        return (m_IndexMask[index / 32] & (1u << (index % 32))) != 0;
+    }
+
+    // Decode events from GeNN spike recording buffer, from first undecoded timestep up to endTimestep
+    void decodeRecordingBuffer(double dt, unsigned long long endTimestep);
+
     //----------------------------------------------------------------------------
     // Members
     //----------------------------------------------------------------------------
-    std::ofstream m_File;
+    // Writer and handle of file events are written to
+    LogWriter &m_LogWriter;
+    unsigned int m_File;
 
     const unsigned int m_PopSize;
 
@@ -217,7 +246,19 @@ private:
 
     void (*m_PullCurrentSpikesFunc)(void);
 
-    std::set<unsigned int> m_Indices;
+    // GeNN spike recording buffer (nullptr if spikes are read from current spike buffer every timestep)
+    // and the number of timesteps it holds
+    uint32_t **m_RecordSpk;
+    const unsigned int m_NumRecordingTimesteps;
+
+    // First timestep which has not yet been decoded from recording buffer
+    unsigned long long m_RecordingStartTimestep;
+
+    // Bitmask of which neurons in population to log
+    std::vector<uint32_t> m_IndexMask;
+
+    // Buffer used to build time and index of each event emitted this timestep
+    std::vector<char> m_OutputBuffer;
 };
 }   // namespace LogOutput
 }   // namespace SpineMLSimulator
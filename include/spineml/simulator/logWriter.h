@@ -0,0 +1,100 @@
+#pragma once
+
+// Standard C++ includes
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Standard C includes
+#include <cstddef>
+#include <cstdint>
+
+//----------------------------------------------------------------------------
+// SpineMLSimulator::LogWriter
+//----------------------------------------------------------------------------
+namespace SpineMLSimulator
+{
+//! Writes data recorded by loggers to file on a dedicated thread
+/*! The simulation thread copies each record into a lock-free, single-producer, single-consumer
+    ring buffer so it only ever blocks if the writer thread falls a whole buffer behind */
+class LogWriter
+{
+public:
+    //! Function used to write a single item of data to a text file on the writer thread
+    typedef void (*FormatFunction)(std::ostream &os, const char *item);
+
+    LogWriter(size_t bufferBytes = (1 << 24));
+    ~LogWriter();
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Open file which data will be written to, returning handle to pass to write
+    /*! If no format function is provided, items are written directly to a binary file.
+        All files must be opened before data is first written */
+    unsigned int openFile(const std::string &filename, size_t itemBytes = 1, FormatFunction format = nullptr);
+
+    //! Copy data, consisting of whole items, into ring buffer to be written to file on writer thread
+    void write(unsigned int file, const void *data, size_t bytes);
+
+private:
+    //------------------------------------------------------------------------
+    // File
+    //------------------------------------------------------------------------
+    struct File
+    {
+        std::ofstream stream;
+        size_t itemBytes;
+        FormatFunction format;
+    };
+
+    //------------------------------------------------------------------------
+    // RecordHeader
+    //------------------------------------------------------------------------
+    //! Header preceding each record in ring buffer
+    struct RecordHeader
+    {
+        uint32_t file;
+        uint32_t bytes;
+    };
+
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    void writerThreadFunc();
+
+    //! Copy data into ring buffer at position, wrapping around end of buffer
+    void copyToBuffer(size_t position, const char *data, size_t bytes);
+
+    //! Copy data out of ring buffer at position, wrapping around end of buffer
+    void copyFromBuffer(size_t position, char *data, size_t bytes) const;
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    //! Ring buffer - size is a power of two so positions can be wrapped with mask
+    std::vector<char> m_Buffer;
+    const size_t m_BufferMask;
+
+    //! Total number of bytes ever written to and read from buffer
+    /*! **NOTE** head is only written by simulation thread and tail by writer thread */
+    std::atomic<size_t> m_Head;
+    std::atomic<size_t> m_Tail;
+
+    //! Files data is written to - only accessed by writer thread once it has started
+    std::vector<std::unique_ptr<File>> m_Files;
+
+    //! Writer thread is started lazily when data is first written
+    std::thread m_WriterThread;
+    std::atomic<bool> m_Stop;
+
+    //! Used to wake writer thread when data is available rather than having it spin
+    std::mutex m_DataAvailableMutex;
+    std::condition_variable m_DataAvailable;
+};
+}   // namespace SpineMLSimulator
@@ -58,6 +58,15 @@ public:
     {
         m_StateVar.pull();
     }
+    void pullRangeFromDevice(size_t offset, size_t count) const
+    {
+        m_StateVar.pullRange(offset, count);
+    }
+
+    bool canPullRangeFromDevice() const
+    {
+        return m_StateVar.canPullRange();
+    }
 
     unsigned int getSize() const
     {
@@ -1,6 +1,7 @@
 #pragma once
 
 // Standard C++ includes
+#include <atomic>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -12,6 +13,7 @@
     #include <arpa/inet.h>
     #include <netinet/in.h>
     #include <netinet/tcp.h>
+    #include <poll.h>
     #include <sys/socket.h>
     #include <sys/types.h>
     #include <unistd.h>
@@ -46,6 +48,9 @@ public:
     NetworkClient();
     NetworkClient(const std::string &hostname, unsigned int port, unsigned int size, DataType dataType, Mode mode, const std::string &connectionName);
     ~NetworkClient();
+
+    NetworkClient(const NetworkClient&) = delete;
+    NetworkClient &operator = (const NetworkClient&) = delete;
     
     //----------------------------------------------------------------------------
     // Public API
@@ -55,6 +60,24 @@ public:
     bool receive(std::vector<double> &buffer);
     bool send(const std::vector<double> &buffer);
 
+    //! Switch connected client to pipelined mode where data is transferred by a NetworkIO thread
+    /*! In this mode, receive and send only block if the network is more than lookahead buffers behind the simulation */
+    void enablePipelining(unsigned int lookahead);
+
+    bool isPipelined() const{ return !m_PipelineBuffers.empty(); }
+
+    //----------------------------------------------------------------------------
+    // NetworkIO thread API
+    //----------------------------------------------------------------------------
+    //! Fill in poll structure with events this pipelined client is waiting for
+    void getPollEvents(pollfd &pollFD) const;
+
+    //! Transfer as much data as possible without blocking after poll has indicated events
+    void processPollEvents(short revents);
+
+    //! Has this pipelined client transferred all data sent by the simulation (or failed)?
+    bool isIdle() const;
+
 private:
     //------------------------------------------------------------------------
     // Enumerations
@@ -66,6 +89,13 @@ private:
         Abort = 43,
         Finished = 44,
     };
+
+    //! State of pipelined transfer
+    enum class PipelineState
+    {
+        Data,       //!< Receiving (Target) or sending (Source) buffer
+        Response,   //!< Sending (Target) or receiving (Source) response to buffer
+    };
     
     //----------------------------------------------------------------------------
     // Private API
@@ -120,10 +150,33 @@ private:
 
     bool sendRequestReadResponse(const std::string &data, Response &response);
 
+    //! Perform non-blocking receive or send of pipelined data
+    /*! Returns number of bytes transferred (zero if operation would block) or -1 if connection has failed */
+    int receiveNonBlocking(char *data, size_t bytes);
+    int sendNonBlocking(const char *data, size_t bytes);
+
+    void setPipelineError(const std::string &message);
+
     //----------------------------------------------------------------------------
     // Private members
     //----------------------------------------------------------------------------
     int m_Socket;
+
+    Mode m_Mode;
+    std::string m_ConnectionName;
+    unsigned int m_Size;
+
+    //! Ring of buffers transferred by NetworkIO thread in pipelined mode
+    /*! m_PipelineHead is advanced by the thread which fills buffers, m_PipelineTail by the thread which empties them */
+    std::vector<std::vector<double>> m_PipelineBuffers;
+    std::atomic<size_t> m_PipelineHead;
+    std::atomic<size_t> m_PipelineTail;
+    std::atomic<bool> m_PipelineError;
+    std::string m_PipelineErrorMessage;
+
+    //! State of transfer currently being performed by NetworkIO thread
+    PipelineState m_PipelineState;
+    size_t m_PipelineBytes;
 };
 
 }   // namespace SpineMLSimulator
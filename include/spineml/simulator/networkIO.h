@@ -0,0 +1,56 @@
+#pragma once
+
+// Standard C++ includes
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Forward declarations
+namespace SpineMLSimulator
+{
+class NetworkClient;
+}
+
+//----------------------------------------------------------------------------
+// SpineMLSimulator::NetworkIO
+//----------------------------------------------------------------------------
+namespace SpineMLSimulator
+{
+//! Transfers data for pipelined network clients on a dedicated thread
+/*! All clients are multiplexed onto a single thread using poll so the simulation only
+    blocks if a remote host falls more than the lookahead number of buffers behind */
+class NetworkIO
+{
+public:
+    NetworkIO();
+    ~NetworkIO();
+
+    NetworkIO(const NetworkIO&) = delete;
+    NetworkIO &operator = (const NetworkIO&) = delete;
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Add connected client - client must remain valid until NetworkIO is destroyed
+    void addClient(NetworkClient &client);
+
+    //! If lookahead is non-zero, switch all clients to pipelined mode and start IO thread
+    /*! Otherwise, clients continue to block the simulation thread while they transfer each buffer */
+    void start(unsigned int lookahead);
+
+private:
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    void ioThreadFunc();
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    //! Clients - only accessed by IO thread once it has started
+    std::vector<NetworkClient*> m_Clients;
+
+    std::thread m_IOThread;
+    std::atomic<bool> m_Stop;
+};
+}   // namespace SpineMLSimulator
@@ -14,7 +14,9 @@
 #include "input.h"
 #include "inputValue.h"
 #include "logOutput.h"
+#include "logWriter.h"
 #include "modelProperty.h"
+#include "networkIO.h"
 
 //----------------------------------------------------------------------------
 // SpineMLSimulator::Simulator
@@ -25,14 +27,19 @@ class Simulator
 {
 public:
     Simulator(plog::Severity logLevel = plog::warning);
-    Simulator(const std::string &experimentXML, const std::string &overrideOutputPath = "", plog::Severity logLevel = plog::warning);
+    Simulator(const std::string &experimentXML, const std::string &overrideOutputPath = "", plog::Severity logLevel = plog::warning,
+              bool binaryEventLogs = false, unsigned int networkLookahead = 0);
     ~Simulator();
 
     //------------------------------------------------------------------------
     // Public API
     //------------------------------------------------------------------------
     //! Load model from XML file
-    void load(const std::string &experimentXML, const std::string &overrideOutputPath = "");
+    /*! If binaryEventLogs is true, event logs are written in binary rather than CSV format.
+        If networkLookahead is non-zero, network inputs and logs are transferred on a separate
+        thread and can run up to networkLookahead transfers ahead of, or behind, the simulation */
+    void load(const std::string &experimentXML, const std::string &overrideOutputPath = "", bool binaryEventLogs = false,
+              unsigned int networkLookahead = 0);
 
     //! Advance simulation by one timestep
     void stepTime();
@@ -110,7 +117,7 @@ private:
                                              const std::map<std::string, std::string> &componentURLs,
                                              const ComponentEventPorts &componentEventPorts);
 
-    std::unique_ptr<LogOutput::Base> createLogOutput(const pugi::xml_node &node, const filesystem::path &logPath,
+    std::unique_ptr<LogOutput::Base> createLogOutput(const pugi::xml_node &node, const filesystem::path &logPath, bool binaryEventLogs,
                                                      const std::map<std::string, unsigned int> &componentSizes,
                                                      const std::map<std::string, std::string> &componentURLs,
                                                      const ComponentEventPorts &componentEventPorts);
@@ -150,6 +157,13 @@ private:
     //! Pointer to simulation timestep symbol in model library
     unsigned long long *m_SimulationTimestep;
 
+    //! Pointer to function in model library to pull spike recording buffers
+    /*! nullptr if model doesn't use GeNN's spike recording system */
+    VoidFunction m_PullRecordingBuffers;
+
+    //! Number of timesteps spike recording buffers hold
+    unsigned int m_NumRecordingTimesteps;
+
     //! Timestep of simulation
     double m_DT;
 
@@ -161,6 +175,9 @@ private:
     double m_SimulateMs;
     double m_LogMs;
 
+    //! Writer used by logging objects to write data to file on a separate thread
+    LogWriter m_LogWriter;
+
     //! Vector of logging objects, updated at the end of each simulation time step
     std::vector<std::unique_ptr<LogOutput::Base>> m_Loggers;
 
@@ -178,5 +195,9 @@ private:
 
     //! Console appender for logging
     plog::ConsoleAppender<plog::TxtFormatter> m_ConsoleAppender;
+
+    //! Transfers data for network loggers and inputs on a separate thread
+    /*! **NOTE** declared last so IO thread is stopped before the network clients it uses are destroyed */
+    NetworkIO m_NetworkIO;
 };
 }   // namespace SpineMLSimulator
@@ -23,6 +23,7 @@ public:
         // If there is no host statevar, it has probably been optimised away so isn't accesible
         if(hostStateVar == nullptr) {
             m_Access = Access::None;
+            m_PullRangeFunc = nullptr;
         }
         // Otherwise
         else {
@@ -38,6 +39,7 @@ public:
                 m_Indirect.getFunc = getCurrentFunc;
                 m_Indirect.pushFunc = reinterpret_cast<PushCurrentFunc>(getLibrarySymbolFunc(("pushCurrent" + stateVarName + "ToDevice").c_str(), false));
                 m_PullFunc = reinterpret_cast<PullFunc>(getLibrarySymbolFunc(("pullCurrent" + stateVarName + "FromDevice").c_str(), false));
+                m_PullRangeFunc = nullptr;
 
                 LOGD_SPINEML << "\t\tIndirect with get function:" << m_Indirect.getFunc << ", push function:" << m_Indirect.pushFunc << ", pull function:" << m_PullFunc;
             }
@@ -50,13 +52,15 @@ public:
                 m_Direct.hostStateVar = *hostStateVar;
                 m_Direct.pushFunc = reinterpret_cast<PushFunc>(getLibrarySymbolFunc(("push" + stateVarName + "ToDevice").c_str(), false));
                 m_PullFunc = reinterpret_cast<PullFunc>(getLibrarySymbolFunc(("pull" + stateVarName + "FromDevice").c_str(), false));
+                m_PullRangeFunc = reinterpret_cast<PullRangeFunc>(getLibrarySymbolFunc(("pull" + stateVarName + "RangeFromDevice").c_str(), true));
 
-                LOGD_SPINEML << "\t\tDirect with host pointer:" << m_Direct.hostStateVar << ", push function:" << m_Direct.pushFunc << ", pull function:" << m_PullFunc;
+                LOGD_SPINEML << "\t\tDirect with host pointer:" << m_Direct.hostStateVar << ", push function:" << m_Direct.pushFunc << ", pull function:" << m_PullFunc << ", pull range function:" << m_PullRangeFunc;
             }
         }
     }
 
     bool isAccessible() const{ return (m_Access != Access::None); }
+    bool canPullRange() const{ return (m_Access == Access::Direct && m_PullRangeFunc != nullptr); }
 
     void push() const
     {
@@ -81,6 +85,21 @@ public:
         }
     }
 
+    //! Pull count elements of variable, starting at offset
+    /*! If model library doesn't provide a function to pull a range of the variable, the whole variable is pulled */
+    void pullRange(size_t offset, size_t count) const
+    {
+        if(m_Access == Access::None) {
+            throw std::runtime_error("Unable to pull inaccessible variable");
+        }
+        else if(m_PullRangeFunc != nullptr) {
+            m_PullRangeFunc(offset, count);
+        }
+        else {
+            m_PullFunc();
+        }
+    }
+
     T *get()
     {
         if(m_Access == Access::Indirect) {
@@ -114,6 +133,7 @@ private:
     typedef T *(*GetCurrentFunc)(void);
     typedef void (*PushFunc)(bool);
     typedef void (*PullFunc)(void);
+    typedef void (*PullRangeFunc)(size_t, size_t);
     typedef void (*PushCurrentFunc)(void);
 
     //--------------------------------------------------------------------
@@ -153,6 +173,7 @@ private:
     // Members
     //--------------------------------------------------------------------
     PullFunc m_PullFunc;
+    PullRangeFunc m_PullRangeFunc;
     Access m_Access;
 
     union
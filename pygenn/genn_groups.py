@@ -14,6 +14,7 @@ from warnings import warn
 import numpy as np
 
 from . import genn_wrapper
+from .genn_wrapper.SharedLibraryModelNumpy import decode_spike_recording
 from . import model_preprocessor
 from .model_preprocessor import ExtraGlobalParameter, Variable
 from .genn_wrapper import (SynapseMatrixConnectivity_SPARSE,
@@ -700,39 +701,34 @@ class NeuronGroup(Group):
                 events[b, d, 0:num_events] = batch_events
 
     def _get_event_recording_data(self, true_spike):
-        # Get byte view of data
         recording_data = (self._spike_recording_data if true_spike 
                           else self._spike_event_recording_data)
-        data_bytes = recording_data.view(dtype=np.uint8)
-
-        # Reshape view into a tensor with time, batches and recording bytes
-        event_recording_bytes = self._event_recording_words * 4
-        data_bytes = np.reshape(data_bytes, (-1, self._model.batch_size, 
-                                                event_recording_bytes))
 
         # Calculate start time of recording
-        start_time_ms = (self._model.timestep - data_bytes.shape[0]) * self._model.dT
+        num_timesteps = (len(recording_data) // (self._event_recording_words 
+                                                 * self._model.batch_size))
+        start_time_ms = (self._model.timestep - num_timesteps) * self._model.dT
         if start_time_ms < 0.0:
             raise Exception("spike_recording_data can only be "
                             "accessed once buffer is full.")
 
-        # Unpack data (results in one byte per bit)
-        # **THINK** is there a way to avoid this step?
-        data_unpack = np.unpackbits(data_bytes, axis=2, 
-                                    count=self.size,
-                                    bitorder="little")
-
         # Loop through batches
         event_data = []
         for b in range(self._model.batch_size):
-            # Calculate indices where there are events
-            events = np.where(data_unpack[:,b,:] == 1)
-
-            # Convert event times to ms
-            event_times = start_time_ms + (events[0] * self._model.dT)
+            # Decode ids of neurons with events, ordered by timestep and
+            # the offset of each timestep's first event in this array
+            # **NOTE** this scales with number of events rather than 
+            # number of neurons x number of timesteps like np.unpackbits
+            event_ids, timestep_offsets = decode_spike_recording(
+                recording_data, self.size, self._model.batch_size, b)
+
+            # Repeat timestep indices for each event and convert to ms
+            event_timesteps = np.repeat(np.arange(num_timesteps),
+                                        np.diff(timestep_offsets))
+            event_times = start_time_ms + (event_timesteps * self._model.dT)
 
             # Add to list
-            event_data.append((event_times, events[1]))
+            event_data.append((event_times, event_ids))
 
         # If batch size is 1, return 1st population's events otherwise list
         return event_data[0] if self._model.batch_size == 1 else event_data
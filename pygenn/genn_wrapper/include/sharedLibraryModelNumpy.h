@@ -1,5 +1,16 @@
 #pragma once
 
+// Standard C++ includes
+#include <algorithm>
+
+// Standard C includes
+#include <cstdint>
+#include <cstdlib>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 // GeNN userproject includes
 #include "../../../userproject/include/sharedLibraryModel.h"
 
@@ -56,3 +67,59 @@ private:
     using SharedLibraryModel<scalar>::ncclGetUniqueID;
     using SharedLibraryModel<scalar>::ncclGetUniqueIDBytes;
 };
+
+//----------------------------------------------------------------------------
+// Free functions
+//----------------------------------------------------------------------------
+// Decode one batch of spike recording data into the ids of the neurons which spiked, 
+// ordered by timestep and then id, and the offset of the first spike of each timestep.
+// Unlike unpacking every bit, the cost of this scales with the number of spikes
+// When used with numpy, wrapper automatically provides numRecordingWords and all outputs
+inline void decodeSpikeRecording(unsigned int *recordingWords, int numRecordingWords, int popSize, int batchSize, int batch,
+                                 unsigned int **ids, int *numIDs, unsigned int **timestepOffsets, int *numTimestepOffsets)
+{
+    const int timestepWords = (popSize + 31) / 32;
+    const int numTimesteps = numRecordingWords / (timestepWords * batchSize);
+
+    // Count spikes so output can be allocated in one go
+    // **NOTE** outputs are allocated with malloc as numpy takes ownership of them
+    size_t numSpikes = 0;
+    for(int t = 0; t < numTimesteps; t++) {
+        const unsigned int *timestepRecording = &recordingWords[((t * batchSize) + batch) * timestepWords];
+        for(int w = 0; w < timestepWords; w++) {
+#ifdef _MSC_VER
+            numSpikes += __popcnt(timestepRecording[w]);
+#else
+            numSpikes += __builtin_popcount(timestepRecording[w]);
+#endif
+        }
+    }
+    *ids = static_cast<unsigned int*>(malloc(std::max<size_t>(1, numSpikes) * sizeof(unsigned int)));
+    *timestepOffsets = static_cast<unsigned int*>(malloc((numTimesteps + 1) * sizeof(unsigned int)));
+    *numIDs = static_cast<int>(numSpikes);
+    *numTimestepOffsets = numTimesteps + 1;
+
+    // Loop through timesteps
+    unsigned int spike = 0;
+    for(int t = 0; t < numTimesteps; t++) {
+        (*timestepOffsets)[t] = spike;
+
+        // Loop through words
+        const unsigned int *timestepRecording = &recordingWords[((t * batchSize) + batch) * timestepWords];
+        for(int w = 0; w < timestepWords; w++) {
+            // While bits remain, find lowest set bit, add corresponding id and clear bit
+            uint32_t spikeWord = timestepRecording[w];
+            while(spikeWord != 0) {
+#ifdef _MSC_VER
+                unsigned long bit;
+                _BitScanForward(&bit, spikeWord);
+#else
+                const int bit = __builtin_ctz(spikeWord);
+#endif
+                (*ids)[spike++] = (w * 32) + bit;
+                spikeWord &= (spikeWord - 1);
+            }
+        }
+    }
+    (*timestepOffsets)[numTimesteps] = spike;
+}
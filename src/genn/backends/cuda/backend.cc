@@ -1756,6 +1756,18 @@ void Backend::genVariablePull(CodeStream &os, const std::string &type, const std
     }
 }
 //--------------------------------------------------------------------------
+void Backend::genVariableRangePull(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc,
+                                   const std::string &offset, const std::string &count) const
+{
+    assert(!getPreferences().automaticCopy);
+
+    if(!(loc & VarLocation::ZERO_COPY)) {
+        os << "CHECK_CUDA_ERRORS(cudaMemcpy(" << name << " + " << offset;
+        os << ", d_"  << name << " + " << offset;
+        os << ", " << count << " * sizeof(" << type << "), cudaMemcpyDeviceToHost));" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
 void Backend::genCurrentVariablePush(CodeStream &os, const NeuronGroupInternal &ng, const std::string &type, 
                                      const std::string &name, VarLocation loc, unsigned int batchSize) const
 {
@@ -0,0 +1,201 @@
+#include "backend.h"
+
+// GeNN code generator includes
+#include "code_generator/codeStream.h"
+#include "code_generator/modelSpecMerged.h"
+#include "code_generator/substitutions.h"
+
+using namespace CodeGenerator;
+
+//--------------------------------------------------------------------------
+// CodeGenerator::MultiThreadedCPU::Backend
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace MultiThreadedCPU
+{
+void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    // Superclass
+    SingleThreadedCPU::Backend::genDefinitionsInternalPreamble(os, modelMerged);
+
+    os << "// Standard C++ includes" << std::endl;
+    os << "#include <vector>" << std::endl;
+    os << std::endl;
+    os << "// OpenMP includes" << std::endl;
+    os << "#include <omp.h>" << std::endl;
+    os << std::endl;
+
+    // Generate atomic addition used to accumulate into variables shared between threads e.g. inSyn
+    // **NOTE** seperate type for value so it can have different precision to address like in user code
+    os << "template<typename T, typename V>" << std::endl;
+    os << "inline void gennAtomicAdd(T *address, V value)";
+    {
+        CodeStream::Scope b(os);
+        os << "#pragma omp atomic" << std::endl;
+        os << "*address += value;" << std::endl;
+    }
+    os << std::endl;
+
+    // Generate atomic fetch-and-add used to increment counters shared between threads e.g. row lengths
+    os << "template<typename T, typename V>" << std::endl;
+    os << "inline T gennAtomicFetchAdd(T *address, V value)";
+    {
+        CodeStream::Scope b(os);
+        os << "T old;" << std::endl;
+        os << "#pragma omp atomic capture" << std::endl;
+        os << "{ old = *address; *address += value; }" << std::endl;
+        os << "return old;" << std::endl;
+    }
+    os << std::endl;
+
+    // Generate atomic or used to set bits in words shared between threads e.g. bitmask connectivity
+    os << "inline void gennAtomicOr(uint32_t *address, uint32_t value)";
+    {
+        CodeStream::Scope b(os);
+        os << "#pragma omp atomic" << std::endl;
+        os << "*address |= value;" << std::endl;
+    }
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void Backend::genAllocateMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged, const MemAlloc &memAlloc) const
+{
+    // Superclass
+    SingleThreadedCPU::Backend::genAllocateMemPreamble(os, modelMerged, memAlloc);
+
+    // If a number of threads is specified, configure OpenMP to use it
+    const unsigned int numThreads = getPreferences<Preferences>().numThreads;
+    if(numThreads != 0) {
+        os << "omp_set_num_threads(" << numThreads << ");" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genMakefilePreamble(std::ostream &os) const
+{
+    // Superclass
+    SingleThreadedCPU::Backend::genMakefilePreamble(os);
+
+    // Add OpenMP flags to both compilation and linking
+    os << "CXXFLAGS += -fopenmp" << std::endl;
+    os << "LINKFLAGS += -fopenmp" << std::endl;
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void Backend::genMSBuildItemDefinitions(std::ostream &os) const
+{
+    // Superclass
+    SingleThreadedCPU::Backend::genMSBuildItemDefinitions(os);
+
+    // Add additional item definition to turn on OpenMP support
+    // **NOTE** LLVM OpenMP runtime is required for unsigned loop indices
+    os << "\t\t<ClCompile>" << std::endl;
+    os << "\t\t\t<OpenMPSupport>true</OpenMPSupport>" << std::endl;
+    os << "\t\t\t<AdditionalOptions>/openmp:llvm %(AdditionalOptions)</AdditionalOptions>" << std::endl;
+    os << "\t\t</ClCompile>" << std::endl;
+}
+//--------------------------------------------------------------------------
+boost::uuids::detail::sha1::digest_type Backend::getHashDigest() const
+{
+    boost::uuids::detail::sha1 hash;
+
+    // Update hash was name of backend
+    Utils::updateHash("MultiThreadedCPU", hash);
+
+    // Update hash with preferences
+    getPreferences<Preferences>().updateHash(hash);
+
+    return hash.get_digest();
+}
+//--------------------------------------------------------------------------
+void Backend::genNeuronUpdateLoop(CodeStream &os, const NeuronUpdateGroupMerged &ng, unsigned int batchSize,
+                                  const Substitutions &popSubs, Handler handler) const
+{
+    // Allocate (once) arrays to hold number of spikes emitted by each chunk of neurons
+    os << "static std::vector<unsigned int> chunkSpkCnt(omp_get_max_threads());" << std::endl;
+    if(ng.getArchetype().isSpikeEventRequired()) {
+        os << "static std::vector<unsigned int> chunkSpkCntEvnt(omp_get_max_threads());" << std::endl;
+    }
+
+    // Split neurons into one chunk per thread, rounded up to a multiple of 32
+    // neurons so threads never write to the same spike recording word
+    os << "const unsigned int numChunks = (unsigned int)chunkSpkCnt.size();" << std::endl;
+    os << "const unsigned int chunkWords = (((group->numNeurons + 31) / 32) + numChunks - 1) / numChunks;" << std::endl;
+
+    // Update chunks in parallel unless neurons require the (not thread-safe) global host RNG
+    if(getPreferences<Preferences>().enableCounterBasedRNG || !ng.getArchetype().isSimRNGRequired()) {
+        os << "#pragma omp parallel for schedule(static, 1)" << std::endl;
+    }
+    os << "for(unsigned int c = 0; c < numChunks; c++)";
+    {
+        CodeStream::Scope b(os);
+        os << "const unsigned int chunkStart = std::min(group->numNeurons, c * chunkWords * 32);" << std::endl;
+        os << "const unsigned int chunkEnd = std::min(group->numNeurons, chunkStart + (chunkWords * 32));" << std::endl;
+
+        // Each chunk initially writes spikes into spike array starting from chunkStart
+        os << "unsigned int lSpkCnt = 0;" << std::endl;
+        if(ng.getArchetype().isSpikeEventRequired()) {
+            os << "unsigned int lSpkCntEvnt = 0;" << std::endl;
+        }
+
+        genNeuronUpdateRange(os, ng, batchSize, popSubs, "chunkStart", "chunkEnd", handler);
+
+        os << "chunkSpkCnt[c] = lSpkCnt;" << std::endl;
+        if(ng.getArchetype().isSpikeEventRequired()) {
+            os << "chunkSpkCntEvnt[c] = lSpkCntEvnt;" << std::endl;
+        }
+    }
+
+    // Serially compact spikes emitted by each chunk, in order, so resultant spike arrays match the single-threaded backend
+    os << "for(unsigned int c = 0; c < numChunks; c++)";
+    {
+        CodeStream::Scope b(os);
+        os << "const unsigned int chunkStart = std::min(group->numNeurons, c * chunkWords * 32);" << std::endl;
+        genCompactChunkSpikes(os, ng, batchSize, true);
+        if(ng.getArchetype().isSpikeEventRequired()) {
+            genCompactChunkSpikes(os, ng, batchSize, false);
+        }
+    }
+}
+//--------------------------------------------------------------------------
+std::string Backend::getSpikeQueueWriteIndex(const NeuronUpdateGroupMerged&, unsigned int, bool trueSpike) const
+{
+    return trueSpike ? "chunkStart + lSpkCnt++" : "chunkStart + lSpkCntEvnt++";
+}
+//--------------------------------------------------------------------------
+void Backend::genParallelForPreamble(CodeStream &os) const
+{
+    // **NOTE** guided scheduling balances uneven iterations e.g. rows of different lengths without too much overhead
+    os << "#pragma omp parallel for schedule(guided)" << std::endl;
+}
+//--------------------------------------------------------------------------
+std::string Backend::getAccumulateTemplate(const std::string &target) const
+{
+    return "gennAtomicAdd(&" + target + ", $(0))";
+}
+//--------------------------------------------------------------------------
+std::string Backend::getSharedIncrement(const std::string &target) const
+{
+    return "gennAtomicFetchAdd(&" + target + ", 1u)";
+}
+//--------------------------------------------------------------------------
+std::string Backend::getSharedBitSet(const std::string &target, const std::string &bits) const
+{
+    return "gennAtomicOr(&" + target + ", " + bits + ")";
+}
+//--------------------------------------------------------------------------
+void Backend::genCompactChunkSpikes(CodeStream &os, const NeuronUpdateGroupMerged &ng, unsigned int batchSize, bool trueSpike) const
+{
+    const std::string suffix = trueSpike ? "" : "Evnt";
+    const std::string spikeQueueOffset = getSpikeQueueOffset(ng, batchSize, trueSpike);
+    const std::string spikeCount = getSpikeCount(ng, batchSize, trueSpike);
+
+    // Move spikes emitted by chunk down from the start of the chunk to the end of the spikes emitted by previous chunks
+    // **NOTE** the previous chunks can have emitted at most chunkStart spikes so this only ever moves spikes backwards
+    os << "std::memmove(&group->spk" << suffix << "[" << spikeQueueOffset << spikeCount << "], ";
+    os << "&group->spk" << suffix << "[" << spikeQueueOffset << "chunkStart], ";
+    os << "chunkSpkCnt" << suffix << "[c] * sizeof(unsigned int));" << std::endl;
+    os << spikeCount << " += chunkSpkCnt" << suffix << "[c];" << std::endl;
+}
+}   // namespace MultiThreadedCPU
+}   // namespace CodeGenerator
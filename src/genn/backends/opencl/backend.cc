@@ -2049,6 +2049,18 @@ void Backend::genVariablePull(CodeStream &os, const std::string &type, const std
     }
 }
 //--------------------------------------------------------------------------
+void Backend::genVariableRangePull(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc,
+                                   const std::string &offset, const std::string &count) const
+{
+    if (!(loc & VarLocation::ZERO_COPY)) {
+        os << "CHECK_OPENCL_ERRORS(commandQueue.enqueueReadBuffer(d_" << name;
+        os << ", " << "CL_TRUE";
+        os << ", " << offset << " * sizeof(" << type << ")";
+        os << ", " << count << " * sizeof(" << type << ")";
+        os << ", " << name << " + " << offset << "));" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
 void Backend::genCurrentVariablePush(CodeStream &os, const NeuronGroupInternal &ng, const std::string &type, 
                                      const std::string &name, VarLocation loc, unsigned int batchSize) const
 {
@@ -1,5 +1,8 @@
 #include "backend.h"
 
+// Standard C++ includes
+#include <algorithm>
+
 // GeNN includes
 #include "gennUtils.h"
 
@@ -72,6 +75,92 @@ const std::vector<Substitutions::FunctionTemplate> &getFunctionTemplates(const s
     return (precision == "double") ? cpuDoublePrecisionFunctions : cpuSinglePrecisionFunctions;
 }
 //-----------------------------------------------------------------------
+template<typename V>
+bool isWriteableVarReferenced(const std::string &code, const std::vector<V> &vars)
+{
+    return std::any_of(vars.cbegin(), vars.cend(),
+                       [&code](const V &v)
+                       {
+                           return !(v.access & VarAccessMode::READ_ONLY) && (code.find("$(" + v.name + ")") != std::string::npos);
+                       });
+}
+//-----------------------------------------------------------------------
+bool canProcessInParallel(const SynapseGroupInternal &sg, const std::string &code, bool rows)
+{
+    // If code uses an RNG, it can't be processed in parallel as calls to the shared host RNG would race
+    // **NOTE** synapse code is never given counter-based RNG streams so this applies whether or not they are enabled
+    if(Utils::isRNGRequired(code)) {
+        return false;
+    }
+
+    // If weights are shared via a kernel, every row and column accesses the same variables so they can't be written
+    const auto *wu = sg.getWUModel();
+    if((sg.getMatrixType() & SynapseMatrixWeight::KERNEL) && isWriteableVarReferenced(code, wu->getVars())) {
+        return false;
+    }
+
+    // Otherwise, variables associated with the opposite dimension can't be written
+    return !isWriteableVarReferenced(code, rows ? wu->getPostVars() : wu->getPreVars());
+}
+//-----------------------------------------------------------------------
+//! Does initialising connectivity (and any kernel variables initialised alongside it) require an RNG?
+bool isConnectivityInitRNGRequired(const SynapseGroupInternal &sg)
+{
+    const auto *snippet = sg.getConnectivityInitialiser().getSnippet();
+    return (Utils::isRNGRequired(snippet->getRowBuildCode()) || Utils::isRNGRequired(snippet->getColBuildCode())
+            || (!sg.getKernelSize().empty() && Utils::isRNGRequired(sg.getWUVarInitialisers())));
+}
+//-----------------------------------------------------------------------
+bool isSpikeDelayRequired(const NeuronUpdateGroupMerged &ng, bool trueSpike)
+{
+    return trueSpike ? (ng.getArchetype().isDelayRequired() && ng.getArchetype().isTrueSpikeRequired()) : ng.getArchetype().isDelayRequired();
+}
+//-----------------------------------------------------------------------
+//! Generate loop through batches (if there are more than one) calling handler with $(batch) substituted
+void genBatchLoop(CodeStream &os, unsigned int batchSize, const Substitutions &subs, BackendBase::Handler handler)
+{
+    Substitutions batchSubs(&subs);
+    if(batchSize > 1) {
+        os << "for(unsigned int batch = 0; batch < " << batchSize << "; batch++)";
+        {
+            CodeStream::Scope b(os);
+            batchSubs.addVarSubstitution("batch", "batch");
+            handler(os, batchSubs);
+        }
+    }
+    else {
+        batchSubs.addVarSubstitution("batch", "0");
+        handler(os, batchSubs);
+    }
+}
+//-----------------------------------------------------------------------
+//! Get offset of current batch's words in spike recording buffer
+std::string getRecordingWordOffset(unsigned int batchSize)
+{
+    if(batchSize > 1) {
+        return "(recordingTimestep * numRecordingWords * " + std::to_string(batchSize) + ") + (batch * numRecordingWords)";
+    }
+    else {
+        return "recordingTimestep * numRecordingWords";
+    }
+}
+//-----------------------------------------------------------------------
+void genCustomUpdateWUBatchOffset(CodeStream &os, const CustomUpdateWUGroupMerged &cg)
+{
+    // Batches are strided by size of kernel or synaptic matrix
+    const SynapseGroupInternal *sg = cg.getArchetype().getSynapseGroup();
+    os << "const unsigned int batchOffset = ";
+    if(sg->getMatrixType() & SynapseMatrixWeight::KERNEL) {
+        for(size_t i = 0; i < sg->getKernelSize().size(); i++) {
+            os << cg.getKernelSize(i) << " * ";
+        }
+    }
+    else {
+        os << "group->numSrcNeurons * group->rowStride * ";
+    }
+    os << "batch;" << std::endl;
+}
+//-----------------------------------------------------------------------
 template<typename G>
 void genKernelIteration(CodeStream &os, const G &g, size_t numKernelDims, const Substitutions &kernelSubs, BackendBase::Handler handler)
 {
@@ -123,13 +212,26 @@ namespace CodeGenerator
 {
 namespace SingleThreadedCPU
 {
+const std::vector<std::unique_ptr<PresynapticUpdateStrategy::Base>> Backend::s_PresynapticUpdateStrategies = []()
+{
+    // **NOTE** strategies are listed in ascending order of preference
+    std::vector<std::unique_ptr<PresynapticUpdateStrategy::Base>> strategies;
+    strategies.emplace_back(new PresynapticUpdateStrategy::RowScatter);
+    strategies.emplace_back(new PresynapticUpdateStrategy::RowScatterBitmask);
+    strategies.emplace_back(new PresynapticUpdateStrategy::RowScatterProcedural);
+    strategies.emplace_back(new PresynapticUpdateStrategy::Toeplitz);
+    strategies.emplace_back(new PresynapticUpdateStrategy::RowScatterVectorised);
+    strategies.emplace_back(new PresynapticUpdateStrategy::RowScatterDeltaEncoded);
+    strategies.emplace_back(new PresynapticUpdateStrategy::TiledDense);
+    strategies.emplace_back(new PresynapticUpdateStrategy::ColumnGather);
+    return strategies;
+}();
+//--------------------------------------------------------------------------
 void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
                               HostHandler preambleHandler, HostHandler pushEGPHandler) const
 {
     const ModelSpecInternal &model = modelMerged.getModel();
-    if(model.getBatchSize() != 1) {
-        throw std::runtime_error("The single-threaded CPU backend only supports simulations with a batch size of 1");
-    }
+    const unsigned int batchSize = model.getBatchSize();
 
     // Generate struct definitions
     modelMerged.genMergedNeuronUpdateGroupStructs(os, *this);
@@ -154,7 +256,6 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
 
         Substitutions funcSubs(getFunctionTemplates(model.getPrecision()));
         funcSubs.addVarSubstitution("t", "t");
-        funcSubs.addVarSubstitution("batch", "0");
 
         // Push any required EGPs
         pushEGPHandler(os);
@@ -172,46 +273,63 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
                 // Get reference to group
                 os << "const auto *group = &mergedNeuronPrevSpikeTimeUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
 
-                if(n.getArchetype().isDelayRequired()) {
-                    // Calculate delay slot corresponding to last timestep
-                    os << "const unsigned int lastTimestepDelaySlot = (*group->spkQuePtr + " << (n.getArchetype().getNumDelaySlots() - 1) << ") % " << n.getArchetype().getNumDelaySlots() << ";" << std::endl;
-                    os << "const unsigned int lastTimestepDelayOffset = lastTimestepDelaySlot * group->numNeurons;" << std::endl;
+                genBatchLoop(os, batchSize, funcSubs,
+                    [batchSize, &n](CodeStream &os, Substitutions&)
+                    {
+                        if(n.getArchetype().isDelayRequired()) {
+                            // Calculate delay slot corresponding to last timestep
+                            os << "const unsigned int lastTimestepDelaySlot = ";
+                            if(batchSize > 1) {
+                                os << "((*group->spkQuePtr + " << (n.getArchetype().getNumDelaySlots() - 1) << ") % " << n.getArchetype().getNumDelaySlots() << ")";
+                                os << " + (batch * " << n.getArchetype().getNumDelaySlots() << ");" << std::endl;
+                            }
+                            else {
+                                os << "(*group->spkQuePtr + " << (n.getArchetype().getNumDelaySlots() - 1) << ") % " << n.getArchetype().getNumDelaySlots() << ";" << std::endl;
+                            }
+                            os << "const unsigned int lastTimestepDelayOffset = lastTimestepDelaySlot * group->numNeurons;" << std::endl;
 
-                    if(n.getArchetype().isPrevSpikeTimeRequired()) {
-                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
-                        os << "for(unsigned int i = 0; i < group->spkCnt[lastTimestepDelaySlot]; i++)";
-                        {
-                            CodeStream::Scope b(os);
-                            os << "group->prevST[lastTimestepDelayOffset + group->spk[lastTimestepDelayOffset + i]] = t - DT;" << std::endl;
-                        }
-                    }
-                    if(n.getArchetype().isPrevSpikeEventTimeRequired()) {
-                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
-                        os << "for(unsigned int i = 0; i < group->spkCntEvnt[lastTimestepDelaySlot]; i++)";
-                        {
-                            CodeStream::Scope b(os);
-                            os << "group->prevSET[lastTimestepDelayOffset + group->spkEvnt[lastTimestepDelayOffset + i]] = t - DT;" << std::endl;
-                        }
-                    }
-                }
-                else {
-                    if(n.getArchetype().isPrevSpikeTimeRequired()) {
-                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
-                        os << "for(unsigned int i = 0; i < group->spkCnt[0]; i++)";
-                        {
-                            CodeStream::Scope b(os);
-                            os << "group->prevST[group->spk[i]] = t - DT;" << std::endl;
+                            if(n.getArchetype().isPrevSpikeTimeRequired()) {
+                                // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
+                                os << "for(unsigned int i = 0; i < group->spkCnt[lastTimestepDelaySlot]; i++)";
+                                {
+                                    CodeStream::Scope b(os);
+                                    os << "group->prevST[lastTimestepDelayOffset + group->spk[lastTimestepDelayOffset + i]] = t - DT;" << std::endl;
+                                }
+                            }
+                            if(n.getArchetype().isPrevSpikeEventTimeRequired()) {
+                                // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
+                                os << "for(unsigned int i = 0; i < group->spkCntEvnt[lastTimestepDelaySlot]; i++)";
+                                {
+                                    CodeStream::Scope b(os);
+                                    os << "group->prevSET[lastTimestepDelayOffset + group->spkEvnt[lastTimestepDelayOffset + i]] = t - DT;" << std::endl;
+                                }
+                            }
                         }
-                    }
-                    if(n.getArchetype().isPrevSpikeEventTimeRequired()) {
-                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
-                        os << "for(unsigned int i = 0; i < group->spkCntEvnt[0]; i++)";
-                        {
-                            CodeStream::Scope b(os);
-                            os << "group->prevSET[group->spkEvnt[i]] = t - DT;" << std::endl;
+                        else {
+                            // If batching is enabled, calculate batch offset
+                            const std::string batchOffset = (batchSize > 1) ? "batchOffset + " : "";
+                            if(batchSize > 1) {
+                                os << "const unsigned int batchOffset = group->numNeurons * batch;" << std::endl;
+                            }
+
+                            if(n.getArchetype().isPrevSpikeTimeRequired()) {
+                                // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
+                                os << "for(unsigned int i = 0; i < group->spkCnt[" << ((batchSize > 1) ? "batch" : "0") << "]; i++)";
+                                {
+                                    CodeStream::Scope b(os);
+                                    os << "group->prevST[" << batchOffset << "group->spk[" << batchOffset << "i]] = t - DT;" << std::endl;
+                                }
+                            }
+                            if(n.getArchetype().isPrevSpikeEventTimeRequired()) {
+                                // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
+                                os << "for(unsigned int i = 0; i < group->spkCntEvnt[" << ((batchSize > 1) ? "batch" : "0") << "]; i++)";
+                                {
+                                    CodeStream::Scope b(os);
+                                    os << "group->prevSET[" << batchOffset << "group->spkEvnt[" << batchOffset << "i]] = t - DT;" << std::endl;
+                                }
+                            }
                         }
-                    }
-                }
+                    });
             }
         }
 
@@ -227,11 +345,17 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
                 os << "const auto *group = &mergedNeuronSpikeQueueUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
 
                 // Generate spike count reset
-                n.genMergedGroupSpikeCountReset(os, 1);
+                genBatchLoop(os, batchSize, funcSubs,
+                             [batchSize, &n](CodeStream &os, Substitutions&)
+                             {
+                                 n.genMergedGroupSpikeCountReset(os, batchSize);
+                             });
             }
             
         }
         // Loop through merged neuron update groups
+        // **NOTE** each group is given a unique index so counter-based RNG streams can be unique to each neuron
+        size_t simRNGGroupIndex = 0;
         for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
             CodeStream::Scope b(os);
             os << "// merged neuron update group " << n.getIndex() << std::endl;
@@ -246,51 +370,61 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
                 if(n.getArchetype().isSpikeRecordingEnabled() || n.getArchetype().isSpikeEventRecordingEnabled()) {
                     // Calculate number of words which will be used to record this population's spikes
                     os << "const unsigned int numRecordingWords = (group->numNeurons + 31) / 32;" << std::endl;
-
-                    // Zero spike recording buffer
-                    if(n.getArchetype().isSpikeRecordingEnabled()) {
-                        os << "std::fill_n(&group->recordSpk[recordingTimestep * numRecordingWords], numRecordingWords, 0);" << std::endl;
-                    }
-
-                    // Zero spike-like-event recording buffer
-                    if(n.getArchetype().isSpikeEventRecordingEnabled()) {
-                        os << "std::fill_n(&group->recordSpkEvent[recordingTimestep * numRecordingWords], numRecordingWords, 0);" << std::endl;
-                    }
                 }
 
-                genNeuronIndexCalculation(os, n, 1);
-                os << std::endl;
+                genBatchLoop(os, batchSize, funcSubs,
+                    [batchSize, simRNGGroupIndex, &modelMerged, &n, this](CodeStream &os, Substitutions &batchSubs)
+                    {
+                        // Zero spike recording buffer
+                        if(n.getArchetype().isSpikeRecordingEnabled()) {
+                            os << "std::fill_n(&group->recordSpk[" << getRecordingWordOffset(batchSize) << "], numRecordingWords, 0);" << std::endl;
+                        }
 
-                os << "for(unsigned int i = 0; i < group->numNeurons; i++)";
-                {
-                    CodeStream::Scope b(os);
+                        // Zero spike-like-event recording buffer
+                        if(n.getArchetype().isSpikeEventRecordingEnabled()) {
+                            os << "std::fill_n(&group->recordSpkEvent[" << getRecordingWordOffset(batchSize) << "], numRecordingWords, 0);" << std::endl;
+                        }
 
-                    Substitutions popSubs(&funcSubs);
-                    popSubs.addVarSubstitution("id", "i");
+                        genNeuronIndexCalculation(os, n, batchSize);
+                        os << std::endl;
 
-                    // If this neuron group requires a simulation RNG, substitute in global RNG
-                    if(n.getArchetype().isSimRNGRequired()) {
-                        popSubs.addVarSubstitution("rng", "hostRNG");
-                    }
+                        genNeuronUpdateLoop(os, n, batchSize, batchSubs,
+                            [batchSize, simRNGGroupIndex, &modelMerged, &n, this](CodeStream &os, Substitutions &popSubs)
+                            {
+                                // If this neuron group requires a simulation RNG
+                                if(n.getArchetype().isSimRNGRequired()) {
+                                    // If counter-based RNG is enabled, use stream unique to this neuron and timestep
+                                    if(getPreferences<Preferences>().enableCounterBasedRNG) {
+                                        const std::string id = (batchSize > 1) ? ("(batch * group->numNeurons) + " + popSubs["id"]) : popSubs["id"];
+                                        genCounterBasedRNGStream(os, popSubs, modelMerged.getModel().getPrecision(), "sim", "simRNGKey",
+                                                                 id, std::to_string(simRNGGroupIndex) + " + g", "(uint32_t)iT");
+                                    }
+                                    // Otherwise, substitute in global RNG
+                                    else {
+                                        popSubs.addVarSubstitution("rng", "hostRNG");
+                                    }
+                                }
 
-                    n.generateNeuronUpdate(*this, os, modelMerged, popSubs,
-                                           // Emit true spikes
-                                           [&modelMerged, this](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
-                                           {
-                                               // Insert code to update WU vars
-                                               ng.generateWUVarUpdate(*this, os, modelMerged, subs);
-
-                                               // Insert code to emit true spikes
-                                               genEmitSpike(os, ng, subs, true, ng.getArchetype().isSpikeRecordingEnabled());
-                                           },
-                                           // Emit spike-like events
-                                           [this](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
-                                           {
-                                               // Insert code to emit spike-like events
-                                               genEmitSpike(os, ng, subs, false, ng.getArchetype().isSpikeEventRecordingEnabled());
-                                           });
-                }
+                                n.generateNeuronUpdate(*this, os, modelMerged, popSubs,
+                                                       // Emit true spikes
+                                                       [batchSize, &modelMerged, this](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
+                                                       {
+                                                           // Insert code to update WU vars
+                                                           ng.generateWUVarUpdate(*this, os, modelMerged, subs);
+
+                                                           // Insert code to emit true spikes
+                                                           genEmitSpike(os, ng, subs, batchSize, true, ng.getArchetype().isSpikeRecordingEnabled());
+                                                       },
+                                                       // Emit spike-like events
+                                                       [batchSize, this](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
+                                                       {
+                                                           // Insert code to emit spike-like events
+                                                           genEmitSpike(os, ng, subs, batchSize, false, ng.getArchetype().isSpikeEventRecordingEnabled());
+                                                       });
+                            });
+                    });
             }
+            simRNGGroupIndex += n.getGroups().size();
         }
     }
 }
@@ -299,9 +433,7 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                                HostHandler preambleHandler, HostHandler pushEGPHandler) const
 {
     const ModelSpecInternal &model = modelMerged.getModel();
-    if(model.getBatchSize() != 1) {
-        throw std::runtime_error("The single-threaded CPU backend only supports simulations with a batch size of 1");
-    }
+    const unsigned int batchSize = model.getBatchSize();
 
     // Generate struct definitions
     // **YUCK** dendritic delay update structs not actually required
@@ -325,7 +457,6 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
         CodeStream::Scope b(os);
         Substitutions funcSubs(getFunctionTemplates(model.getPrecision()));
         funcSubs.addVarSubstitution("t", "t");
-        funcSubs.addVarSubstitution("batch", "0");
 
         // Push any required EGPs
         pushEGPHandler(os);
@@ -344,57 +475,75 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                     // Get reference to group
                     os << "const auto *group = &mergedSynapseDynamicsGroup" << s.getIndex() << "[g]; " << std::endl;
 
-                    genSynapseIndexCalculation(os, s, 1);
-
-                    // Loop through presynaptic neurons
-                    os << "for(unsigned int i = 0; i < group->numSrcNeurons; i++)";
-                    {
-                        // If this synapse group has sparse connectivity, loop through length of this row
-                        CodeStream::Scope b(os);
-                        if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                            os << "for(unsigned int s = 0; s < group->rowLength[i]; s++)";
-                        }
-                        // Otherwise, if it's dense, loop through each postsynaptic neuron
-                        else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::DENSE) {
-                            os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
-                        }
-                        else {
-                            throw std::runtime_error("Only DENSE and SPARSE format connectivity can be used for synapse dynamics");
-                        }
+                    genBatchLoop(os, batchSize, funcSubs,
+                        [batchSize, &modelMerged, &s, this](CodeStream &os, Substitutions &batchSubs)
                         {
-                            CodeStream::Scope b(os);
-
-                            Substitutions synSubs(&funcSubs);
-                            if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                // Calculate index of synapse and use it to look up postsynaptic index
-                                os << "const unsigned int n = (i * group->rowStride) + s;" << std::endl;
-                                os << "const unsigned int j = group->ind[n];" << std::endl;
+                            genSynapseIndexCalculation(os, s, batchSize);
 
-                                synSubs.addVarSubstitution("id_syn", "n");
-                            }
-                            else {
-                                synSubs.addVarSubstitution("id_syn", "(i * group->numTrgNeurons) + j");
+                            // Loop through presynaptic neurons
+                            if(canProcessRowsInParallel(s.getArchetype(), s.getArchetype().getWUModel()->getSynapseDynamicsCode())) {
+                                genParallelForPreamble(os);
                             }
+                            os << "for(unsigned int i = 0; i < group->numSrcNeurons; i++)";
+                            {
+                                // If this synapse group has sparse connectivity, loop through length of this row
+                                CodeStream::Scope b(os);
+                                if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                    // If sparse indices are delta-encoded, point decoder at start of row
+                                    if(s.getArchetype().isDeltaEncodedSparseIndEnabled()) {
+                                        os << "const uint8_t *indDeltaPtr = &group->indDelta[(size_t)i * group->indDeltaStride];" << std::endl;
+                                        os << "unsigned int j = 0;" << std::endl;
+                                    }
+                                    os << "for(unsigned int s = 0; s < group->rowLength[i]; s++)";
+                                }
+                                // Otherwise, if it's dense, loop through each postsynaptic neuron
+                                else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::DENSE) {
+                                    os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
+                                }
+                                else {
+                                    throw std::runtime_error("Only DENSE and SPARSE format connectivity can be used for synapse dynamics");
+                                }
+                                {
+                                    CodeStream::Scope b(os);
 
-                            // Add pre and postsynaptic indices to substitutions
-                            synSubs.addVarSubstitution("id_pre", "i");
-                            synSubs.addVarSubstitution("id_post", "j");
+                                    Substitutions synSubs(&batchSubs);
+                                    if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                        // Calculate index of synapse and use it to look up postsynaptic index
+                                        // **NOTE** if sparse indices are delta-encoded, they are instead decoded from the row
+                                        os << "const unsigned int n = (i * group->rowStride) + s;" << std::endl;
+                                        if(s.getArchetype().isDeltaEncodedSparseIndEnabled()) {
+                                            os << "j += gennDecodeIndDelta(indDeltaPtr);" << std::endl;
+                                        }
+                                        else {
+                                            os << "const unsigned int j = group->ind[n];" << std::endl;
+                                        }
 
-                            // Add correct functions for apply synaptic input
-                            if(s.getArchetype().isDendriticDelayRequired()) {
-                                synSubs.addFuncSubstitution("addToInSynDelay", 2, "group->denDelay[" + s.getPostDenDelayIndex(1, "j", "$(1)") + "] += $(0)");
-                            }
-                            else {
-                                synSubs.addFuncSubstitution("addToInSyn", 1, "group->inSyn[" + s.getPostISynIndex(1, "j") + "] += $(0)");
-                            }
+                                        synSubs.addVarSubstitution("id_syn", "n");
+                                    }
+                                    else {
+                                        synSubs.addVarSubstitution("id_syn", "(i * group->numTrgNeurons) + j");
+                                    }
+
+                                    // Add pre and postsynaptic indices to substitutions
+                                    synSubs.addVarSubstitution("id_pre", "i");
+                                    synSubs.addVarSubstitution("id_post", "j");
+
+                                    // Add correct functions for apply synaptic input
+                                    if(s.getArchetype().isDendriticDelayRequired()) {
+                                        synSubs.addFuncSubstitution("addToInSynDelay", 2, getAccumulateTemplate("group->denDelay[" + s.getPostDenDelayIndex(batchSize, "j", "$(1)") + "]"));
+                                    }
+                                    else {
+                                        synSubs.addFuncSubstitution("addToInSyn", 1, getAccumulateTemplate("group->inSyn[" + s.getPostISynIndex(batchSize, "j") + "]"));
+                                    }
 
-                            if(s.getArchetype().isPresynapticOutputRequired()) {
-                                synSubs.addFuncSubstitution("addToPre", 1, "group->revInSyn[" + s.getPreISynIndex(1, synSubs["id_pre"]) + "] += $(0)");
+                                    if(s.getArchetype().isPresynapticOutputRequired()) {
+                                        synSubs.addFuncSubstitution("addToPre", 1, getAccumulateTemplate("group->revInSyn[" + s.getPreISynIndex(batchSize, synSubs["id_pre"]) + "]"));
+                                    }
+                                    // Call synapse dynamics handler
+                                    s.generateSynapseUpdate(*this, os, modelMerged, synSubs);
+                                }
                             }
-                            // Call synapse dynamics handler
-                            s.generateSynapseUpdate(*this, os, modelMerged, synSubs);
-                        }
-                    }
+                        });
                 }
             }
         }
@@ -412,17 +561,21 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                     // Get reference to group
                     os << "const auto *group = &mergedPresynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
 
-                    genSynapseIndexCalculation(os, s, 1);
+                    genBatchLoop(os, batchSize, funcSubs,
+                        [batchSize, &modelMerged, &s, this](CodeStream &os, Substitutions &batchSubs)
+                        {
+                            genSynapseIndexCalculation(os, s, batchSize);
                     
-                    // generate the code for processing spike-like events
-                    if (s.getArchetype().isSpikeEventRequired()) {
-                        genPresynapticUpdate(os, modelMerged, s, funcSubs, false);
-                    }
+                            // generate the code for processing spike-like events
+                            if (s.getArchetype().isSpikeEventRequired()) {
+                                genPresynapticUpdate(os, modelMerged, s, batchSubs, false);
+                            }
 
-                    // generate the code for processing true spike events
-                    if (s.getArchetype().isTrueSpikeRequired()) {
-                        genPresynapticUpdate(os, modelMerged, s, funcSubs, true);
-                    }
+                            // generate the code for processing true spike events
+                            if (s.getArchetype().isTrueSpikeRequired()) {
+                                genPresynapticUpdate(os, modelMerged, s, batchSubs, true);
+                            }
+                        });
                     os << std::endl;
                 }
             }
@@ -441,56 +594,87 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                     // Get reference to group
                     os << "const auto *group = &mergedPostsynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
 
-                    genSynapseIndexCalculation(os, s, 1);
-
-                    // Get number of postsynaptic spikes
-                    if (s.getArchetype().getTrgNeuronGroup()->isDelayRequired() && s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired()) {
-                        os << "const unsigned int numSpikes = group->trgSpkCnt[postDelaySlot];" << std::endl;
-                    }
-                    else {
-                        os << "const unsigned int numSpikes = group->trgSpkCnt[0];" << std::endl;
-                    }
-
-                    // Loop through postsynaptic spikes
-                    os << "for (unsigned int j = 0; j < numSpikes; j++)";
-                    {
-                        CodeStream::Scope b(os);
-
-                        const std::string offsetTrueSpkPost = (s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired() && s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) ? "postDelayOffset + " : "";
-                        os << "const unsigned int spike = group->trgSpk[" << offsetTrueSpkPost << "j];" << std::endl;
-
-                        // Loop through column of presynaptic neurons
-                        if (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                            os << "const unsigned int npre = group->colLength[spike];" << std::endl;
-                            os << "for (unsigned int i = 0; i < npre; i++)";
-                        }
-                        else {
-                            os << "for (unsigned int i = 0; i < group->numSrcNeurons; i++)";
-                        }
+                    genBatchLoop(os, batchSize, funcSubs,
+                        [batchSize, &modelMerged, &s, this](CodeStream &os, Substitutions &batchSubs)
                         {
-                            CodeStream::Scope b(os);
+                            genSynapseIndexCalculation(os, s, batchSize);
+
+                            // Get number of postsynaptic spikes
+                            const bool trgSpikeDelayRequired = (s.getArchetype().getTrgNeuronGroup()->isDelayRequired() && s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired());
+                            os << "const unsigned int numSpikes = group->trgSpkCnt[" << s.getPostVarIndex(trgSpikeDelayRequired, batchSize, VarAccessDuplication::SHARED_NEURON, "") << "];" << std::endl;
 
-                            Substitutions synSubs(&funcSubs);
+                            // If connectivity is sparse
+                            const std::string &learnPostCode = s.getArchetype().getWUModel()->getLearnPostCode();
                             if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                os << "const unsigned int colMajorIndex = (spike * group->colStride) + i;" << std::endl;
-                                os << "const unsigned int rowMajorIndex = group->remap[colMajorIndex];" << std::endl;
+                                // If all groups have the same row stride, divide by a literal so the compiler can replace the division with a
+                                // multiplication; otherwise, calculate multiplier for fast division by this group's row stride at runtime
+                                const bool rowStrideHomogeneous = isRowStrideHomogeneous(s);
+                                if(!rowStrideHomogeneous) {
+                                    os << "const uint64_t rowStrideMagic = gennFastDivideMagic(group->rowStride);" << std::endl;
+                                }
+
+                                // Loop through postsynaptic spikes
+                                if(canProcessColumnsInParallel(s.getArchetype(), learnPostCode)) {
+                                    genParallelForPreamble(os);
+                                }
+                                os << "for (unsigned int j = 0; j < numSpikes; j++)";
+                                {
+                                    CodeStream::Scope b(os);
 
-                                // **TODO** fast divide optimisations
-                                synSubs.addVarSubstitution("id_pre", "(rowMajorIndex / group->rowStride)");
-                                synSubs.addVarSubstitution("id_syn", "rowMajorIndex");
+                                    os << "const unsigned int spike = group->trgSpk[" << s.getPostVarIndex(trgSpikeDelayRequired, batchSize, VarAccessDuplication::DUPLICATE, "j") << "];" << std::endl;
+
+                                    // Loop through column of presynaptic neurons
+                                    os << "const unsigned int npre = group->colLength[spike];" << std::endl;
+                                    os << "for (unsigned int i = 0; i < npre; i++)";
+                                    {
+                                        CodeStream::Scope b(os);
+
+                                        // Use remapping to find index of synapse in row-major matrix and, from this, the presynaptic index
+                                        os << "const unsigned int colMajorIndex = (spike * group->colStride) + i;" << std::endl;
+                                        os << "const unsigned int rowMajorIndex = group->remap[colMajorIndex];" << std::endl;
+                                        if(rowStrideHomogeneous) {
+                                            os << "const unsigned int preIndex = rowMajorIndex / " << getSynapticMatrixRowStride(s.getArchetype()) << ";" << std::endl;
+                                        }
+                                        else {
+                                            os << "const unsigned int preIndex = gennFastDivide(rowMajorIndex, rowStrideMagic, group->rowStride);" << std::endl;
+                                        }
+
+                                        Substitutions synSubs(&batchSubs);
+                                        synSubs.addVarSubstitution("id_pre", "preIndex");
+                                        synSubs.addVarSubstitution("id_syn", "rowMajorIndex");
+                                        genPostsynapticUpdateSynapse(os, modelMerged, s, synSubs, batchSize, true);
+                                    }
+                                }
                             }
+                            // Otherwise, if connectivity is dense
+                            // **NOTE** rather than striding down a column of the row-major matrix for each spike, loop through rows
+                            // and, within each row, through the spiking columns. Any two synapses which access the same
+                            // variable are still updated in the same order so results are identical
                             else {
-                                synSubs.addVarSubstitution("id_pre", "i");
-                                synSubs.addVarSubstitution("id_syn", "((group->numTrgNeurons * i) + spike)");
-                            }
-                            synSubs.addVarSubstitution("id_post", "spike");
-                            if (s.getArchetype().isPresynapticOutputRequired()) {
-                                synSubs.addFuncSubstitution("addToPre", 1, "group->revInSyn[" + s.getPreISynIndex(1, synSubs["id_pre"]) + "] += $(0)");        
+                                if(canProcessRowsInParallel(s.getArchetype(), learnPostCode)) {
+                                    genParallelForPreamble(os);
+                                }
+                                os << "for (unsigned int i = 0; i < group->numSrcNeurons; i++)";
+                                {
+                                    CodeStream::Scope b(os);
+
+                                    os << "const unsigned int rowStartIndex = group->numTrgNeurons * i;" << std::endl;
+                                    os << "for (unsigned int j = 0; j < numSpikes; j++)";
+                                    {
+                                        CodeStream::Scope b(os);
+
+                                        os << "const unsigned int spike = group->trgSpk[" << s.getPostVarIndex(trgSpikeDelayRequired, batchSize, VarAccessDuplication::DUPLICATE, "j") << "];" << std::endl;
+
+                                        Substitutions synSubs(&batchSubs);
+                                        synSubs.addVarSubstitution("id_pre", "i");
+                                        synSubs.addVarSubstitution("id_syn", "(rowStartIndex + spike)");
+
+                                        // **NOTE** each row is only processed by one iteration so presynaptic output doesn't need to be shared
+                                        genPostsynapticUpdateSynapse(os, modelMerged, s, synSubs, batchSize, false);
+                                    }
+                                }
                             }
-            
-                            s.generateSynapseUpdate(*this, os, modelMerged, synSubs);
-                        }
-                    }
+                        });
                     os << std::endl;
                 }
             }
@@ -498,10 +682,23 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
     }
 }
 //--------------------------------------------------------------------------
+void Backend::genPostsynapticUpdateSynapse(CodeStream &os, const ModelSpecMerged &modelMerged, const PostsynapticUpdateGroupMerged &sg,
+                                           Substitutions &synSubs, unsigned int batchSize, bool sharedPreOutput) const
+{
+    synSubs.addVarSubstitution("id_post", "spike");
+    if (sg.getArchetype().isPresynapticOutputRequired()) {
+        const std::string target = "group->revInSyn[" + sg.getPreISynIndex(batchSize, synSubs["id_pre"]) + "]";
+        synSubs.addFuncSubstitution("addToPre", 1, sharedPreOutput ? getAccumulateTemplate(target) : (target + " += $(0)"));
+    }
+
+    sg.generateSynapseUpdate(*this, os, modelMerged, synSubs);
+}
+//--------------------------------------------------------------------------
 void Backend::genCustomUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
                               HostHandler preambleHandler, HostHandler pushEGPHandler) const
 {
     const ModelSpecInternal &model = modelMerged.getModel();
+    const unsigned int batchSize = model.getBatchSize();
 
     // Generate struct definitions
     modelMerged.genMergedCustomUpdateStructs(os, *this);
@@ -533,7 +730,6 @@ void Backend::genCustomUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
 
             Substitutions funcSubs(getFunctionTemplates(model.getPrecision()));
             funcSubs.addVarSubstitution("t", "t");
-            funcSubs.addVarSubstitution("batch", "0");
 
             // Push any required EGPs
             pushEGPHandler(os);
@@ -557,38 +753,12 @@ void Backend::genCustomUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
                         // Get reference to group
                         os << "const auto *group = &mergedCustomUpdateGroup" << c.getIndex() << "[g]; " << std::endl;
 
-                        genCustomUpdateIndexCalculation(os, c);
-
-                        if (c.getArchetype().isNeuronReduction()) {
-                            // Initialise reduction targets
-                            const auto reductionTargets = genInitReductionTargets(os, c);
-
-                            // Loop through group members
-                            os << "for(unsigned int i = 0; i < group->size; i++)";
-                            {
-                                CodeStream::Scope b(os);
-
-                                Substitutions popSubs(&funcSubs);
-                                popSubs.addVarSubstitution("id", "i");
-
-                                // Generate custom update
-                                c.generateCustomUpdate(*this, os, modelMerged, popSubs);
-
-                                // Loop through reduction targets and generate reduction
-                                for (const auto &r : reductionTargets) {
-                                    os << getReductionOperation("lr" + r.name, "l" + r.name, r.access, r.type) << ";" << std::endl;
-                                }
-                            }
-
-                            // Write back reductions
-                            for (const auto &r : reductionTargets) {
-                                os << "group->" << r.name << "[" << r.index << "] = lr" << r.name << ";" << std::endl;
-                            }
-                        }
-                        else {
+                        // If this update is a batched batch reduction
+                        if(c.getArchetype().isBatched() && c.getArchetype().isBatchReduction()) {
                             // Loop through group members
                             Substitutions popSubs(&funcSubs);
                             if (c.getArchetype().isPerNeuron()) {
+                                genParallelForPreamble(os);
                                 os << "for(unsigned int i = 0; i < group->size; i++)";
                                 popSubs.addVarSubstitution("id", "i");
                             }
@@ -598,13 +768,85 @@ void Backend::genCustomUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
                             {
                                 CodeStream::Scope b(os);
 
-                                // Generate custom update
-                                c.generateCustomUpdate(*this, os, modelMerged, popSubs);
+                                // Initialise reduction targets
+                                const auto reductionTargets = genInitReductionTargets(os, c, popSubs["id"]);
+
+                                // Loop through batches
+                                genBatchLoop(os, batchSize, popSubs,
+                                    [&c, &modelMerged, &reductionTargets, this](CodeStream &os, Substitutions &batchSubs)
+                                    {
+                                        genCustomUpdateIndexCalculation(os, c);
+
+                                        // Generate custom update
+                                        c.generateCustomUpdate(*this, os, modelMerged, batchSubs);
+
+                                        // Loop through reduction targets and generate reduction
+                                        for (const auto &r : reductionTargets) {
+                                            os << getReductionOperation("lr" + r.name, "l" + r.name, r.access, r.type) << ";" << std::endl;
+                                        }
+                                    });
 
                                 // Write back reductions
-                                genWriteBackReductions(os, c, popSubs["id"]);
+                                for (const auto &r : reductionTargets) {
+                                    os << "group->" << r.name << "[" << r.index << "] = lr" << r.name << ";" << std::endl;
+                                }
                             }
                         }
+                        else {
+                            genBatchLoop(os, c.getArchetype().isBatched() ? batchSize : 1, funcSubs,
+                                [&c, &modelMerged, this](CodeStream &os, Substitutions &batchSubs)
+                                {
+                                    genCustomUpdateIndexCalculation(os, c);
+
+                                    if (c.getArchetype().isNeuronReduction()) {
+                                        // Initialise reduction targets
+                                        const auto reductionTargets = genInitReductionTargets(os, c);
+
+                                        // Loop through group members
+                                        os << "for(unsigned int i = 0; i < group->size; i++)";
+                                        {
+                                            CodeStream::Scope b(os);
+
+                                            Substitutions popSubs(&batchSubs);
+                                            popSubs.addVarSubstitution("id", "i");
+
+                                            // Generate custom update
+                                            c.generateCustomUpdate(*this, os, modelMerged, popSubs);
+
+                                            // Loop through reduction targets and generate reduction
+                                            for (const auto &r : reductionTargets) {
+                                                os << getReductionOperation("lr" + r.name, "l" + r.name, r.access, r.type) << ";" << std::endl;
+                                            }
+                                        }
+
+                                        // Write back reductions
+                                        for (const auto &r : reductionTargets) {
+                                            os << "group->" << r.name << "[" << r.index << "] = lr" << r.name << ";" << std::endl;
+                                        }
+                                    }
+                                    else {
+                                        // Loop through group members
+                                        Substitutions popSubs(&batchSubs);
+                                        if (c.getArchetype().isPerNeuron()) {
+                                            genParallelForPreamble(os);
+                                            os << "for(unsigned int i = 0; i < group->size; i++)";
+                                            popSubs.addVarSubstitution("id", "i");
+                                        }
+                                        else {
+                                            popSubs.addVarSubstitution("id", "0");
+                                        }
+                                        {
+                                            CodeStream::Scope b(os);
+
+                                            // Generate custom update
+                                            c.generateCustomUpdate(*this, os, modelMerged, popSubs);
+
+                                            // Write back reductions
+                                            genWriteBackReductions(os, c, popSubs["id"]);
+                                        }
+                                    }
+                                });
+                        }
                     }
                 }
 
@@ -624,62 +866,98 @@ void Backend::genCustomUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
                         // Get reference to group
                         os << "const auto *group = &mergedCustomUpdateWUGroup" << c.getIndex() << "[g]; " << std::endl;
 
-                        const SynapseGroupInternal *sg = c.getArchetype().getSynapseGroup();
-                        if (sg->getMatrixType() & SynapseMatrixWeight::KERNEL) {
-                            genKernelIteration(os, c, c.getArchetype().getSynapseGroup()->getKernelSize().size(), funcSubs,
-                                               [&c, &modelMerged, this]
-                                               (CodeStream &os, Substitutions &subs)
-                                               {
-                                                   // Call custom update handler
-                                                   c.generateCustomUpdate(*this, os, modelMerged, subs);
+                        // If this update is a batched batch reduction, batches are looped over within each synapse
+                        const bool batchReduction = (c.getArchetype().isBatched() && c.getArchetype().isBatchReduction());
+                        const Handler synapseHandler =
+                            [batchReduction, batchSize, &c, &modelMerged, this](CodeStream &os, Substitutions &synSubs)
+                            {
+                                if(batchReduction) {
+                                    // Initialise reduction targets
+                                    const auto reductionTargets = genInitReductionTargets(os, c, synSubs["id_syn"]);
 
-                                                   // Write back reductions
-                                                   genWriteBackReductions(os, c, subs["id_syn"]);
-                                               });
-                        }
-                        else {
-                            // Loop through presynaptic neurons
-                            os << "for(unsigned int i = 0; i < group->numSrcNeurons; i++)";
+                                    // Loop through batches
+                                    genBatchLoop(os, batchSize, synSubs,
+                                        [&c, &modelMerged, &reductionTargets, this](CodeStream &os, Substitutions &batchSubs)
+                                        {
+                                            genCustomUpdateWUBatchOffset(os, c);
+
+                                            // Call custom update handler
+                                            c.generateCustomUpdate(*this, os, modelMerged, batchSubs);
+
+                                            // Loop through reduction targets and generate reduction
+                                            for (const auto &r : reductionTargets) {
+                                                os << getReductionOperation("lr" + r.name, "l" + r.name, r.access, r.type) << ";" << std::endl;
+                                            }
+                                        });
+
+                                    // Write back reductions
+                                    for (const auto &r : reductionTargets) {
+                                        os << "group->" << r.name << "[" << r.index << "] = lr" << r.name << ";" << std::endl;
+                                    }
+                                }
+                                else {
+                                    // Call custom update handler
+                                    c.generateCustomUpdate(*this, os, modelMerged, synSubs);
+
+                                    // Write back reductions
+                                    genWriteBackReductions(os, c, synSubs["id_syn"]);
+                                }
+                            };
+
+                        genBatchLoop(os, (c.getArchetype().isBatched() && !batchReduction) ? batchSize : 1, funcSubs,
+                            [batchReduction, &c, &synapseHandler, this](CodeStream &os, Substitutions &batchSubs)
                             {
-                                // If this synapse group has sparse connectivity, loop through length of this row
-                                CodeStream::Scope b(os);
-                                if (sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                    os << "for(unsigned int s = 0; s < group->rowLength[i]; s++)";
+                                // Calculate batch offset if required
+                                if(c.getArchetype().isBatched() && !batchReduction) {
+                                    genCustomUpdateWUBatchOffset(os, c);
                                 }
-                                // Otherwise, if it's dense, loop through each postsynaptic neuron
-                                else if (sg->getMatrixType() & SynapseMatrixConnectivity::DENSE) {
-                                    os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
+
+                                const SynapseGroupInternal *sg = c.getArchetype().getSynapseGroup();
+                                if (sg->getMatrixType() & SynapseMatrixWeight::KERNEL) {
+                                    genKernelIteration(os, c, c.getArchetype().getSynapseGroup()->getKernelSize().size(), batchSubs, synapseHandler);
                                 }
                                 else {
-                                    throw std::runtime_error("Only DENSE and SPARSE format connectivity can be used for custom updates");
+                                    // Loop through presynaptic neurons
+                                    genParallelForPreamble(os);
+                                    os << "for(unsigned int i = 0; i < group->numSrcNeurons; i++)";
+                                    {
+                                        // If this synapse group has sparse connectivity, loop through length of this row
+                                        CodeStream::Scope b(os);
+                                        if (sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                            os << "for(unsigned int s = 0; s < group->rowLength[i]; s++)";
+                                        }
+                                        // Otherwise, if it's dense, loop through each postsynaptic neuron
+                                        else if (sg->getMatrixType() & SynapseMatrixConnectivity::DENSE) {
+                                            os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
+                                        }
+                                        else {
+                                            throw std::runtime_error("Only DENSE and SPARSE format connectivity can be used for custom updates");
+                                        }
+                                        {
+                                            CodeStream::Scope b(os);
+
+                                            Substitutions synSubs(&batchSubs);
+                                            if (sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                                // Calculate index of synapse and use it to look up postsynaptic index
+                                                os << "const unsigned int n = (i * group->rowStride) + s;" << std::endl;
+                                                os << "const unsigned int j = group->ind[n];" << std::endl;
+
+                                                synSubs.addVarSubstitution("id_syn", "n");
+                                            }
+                                            else {
+                                                synSubs.addVarSubstitution("id_syn", "(i * group->numTrgNeurons) + j");
+                                            }
+
+                                            // Add pre and postsynaptic indices to substitutions
+                                            synSubs.addVarSubstitution("id_pre", "i");
+                                            synSubs.addVarSubstitution("id_post", "j");
+
+                                            // Call synapse handler
+                                            synapseHandler(os, synSubs);
+                                        }
+                                    }
                                 }
-                                {
-                                    CodeStream::Scope b(os);
-
-                                    Substitutions synSubs(&funcSubs);
-                                    if (sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                        // Calculate index of synapse and use it to look up postsynaptic index
-                                        os << "const unsigned int n = (i * group->rowStride) + s;" << std::endl;
-                                        os << "const unsigned int j = group->ind[n];" << std::endl;
-
-                                        synSubs.addVarSubstitution("id_syn", "n");
-                                    }
-                                    else {
-                                        synSubs.addVarSubstitution("id_syn", "(i * group->numTrgNeurons) + j");
-                                    }
-
-                                    // Add pre and postsynaptic indices to substitutions
-                                    synSubs.addVarSubstitution("id_pre", "i");
-                                    synSubs.addVarSubstitution("id_post", "j");
-
-                                    // Call custom update handler
-                                    c.generateCustomUpdate(*this, os, modelMerged, synSubs);
-
-                                    // Write back reductions
-                                    genWriteBackReductions(os, c, synSubs["id_syn"]);
-                                }
-                            }
-                        }
+                            });
                     }
                 }
             }
@@ -708,31 +986,44 @@ void Backend::genCustomUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
                                                                                   [](const Models::WUVarReference &v) { return v.getTransposeSynapseGroup() != nullptr; }));
                         const std::string transposeVarName = c.getArchetype().getCustomUpdateModel()->getVarRefs().at(transposeVarIdx).name;
 
-                        // Loop through presynaptic neurons
-                        os << "for(unsigned int i = 0; i < group->numSrcNeurons; i++)";
-                        {
-                            CodeStream::Scope b(os);
-
-                            // Loop through each postsynaptic neuron
-                            os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
+                        genBatchLoop(os, c.getArchetype().isBatched() ? batchSize : 1, funcSubs,
+                            [&c, &modelMerged, &transposeVarName, this](CodeStream &os, Substitutions &batchSubs)
                             {
-                                CodeStream::Scope b(os);
+                                // Calculate batch offset if required
+                                if(c.getArchetype().isBatched()) {
+                                    os << "const unsigned int batchOffset = group->numSrcNeurons * group->numTrgNeurons * batch;" << std::endl;
+                                }
 
-                                Substitutions synSubs(&funcSubs);
-                                synSubs.addVarSubstitution("id_syn", "(i * group->numTrgNeurons) + j");
+                                // Loop through presynaptic neurons
+                                genParallelForPreamble(os);
+                                os << "for(unsigned int i = 0; i < group->numSrcNeurons; i++)";
+                                {
+                                    CodeStream::Scope b(os);
+
+                                    // Loop through each postsynaptic neuron
+                                    os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
+                                    {
+                                        CodeStream::Scope b(os);
 
-                                // Add pre and postsynaptic indices to substitutions
-                                synSubs.addVarSubstitution("id_pre", "i");
-                                synSubs.addVarSubstitution("id_post", "j");
+                                        Substitutions synSubs(&batchSubs);
+                                        synSubs.addVarSubstitution("id_syn", "(i * group->numTrgNeurons) + j");
 
-                                // Call custom update handler
-                                c.generateCustomUpdate(*this, os, modelMerged, synSubs);
+                                        // Add pre and postsynaptic indices to substitutions
+                                        synSubs.addVarSubstitution("id_pre", "i");
+                                        synSubs.addVarSubstitution("id_post", "j");
 
-                                // Update transpose variable
-                                os << "group->" << transposeVarName << "Transpose[(j * group->numSrcNeurons) + i] = l" << transposeVarName << ";" << std::endl;
-                            }
-                        }
+                                        // Call custom update handler
+                                        c.generateCustomUpdate(*this, os, modelMerged, synSubs);
 
+                                        // Update transpose variable
+                                        os << "group->" << transposeVarName << "Transpose[";
+                                        if(c.getArchetype().isBatched()) {
+                                            os << "batchOffset + ";
+                                        }
+                                        os << "(j * group->numSrcNeurons) + i] = l" << transposeVarName << ";" << std::endl;
+                                    }
+                                }
+                            });
                     }
                 }
             }
@@ -744,9 +1035,6 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                       HostHandler preambleHandler, HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const
 {
     const ModelSpecInternal &model = modelMerged.getModel();
-    if(model.getBatchSize() != 1) {
-        throw std::runtime_error("The single-threaded CPU backend only supports simulations with a batch size of 1");
-    }
 
     // Generate struct definitions
     modelMerged.genMergedNeuronInitGroupStructs(os, *this);
@@ -784,6 +1072,23 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
             funcSubs.addVarSubstitution("rng", "hostRNG");
         }
 
+        // If counter-based RNG streams are required, generate keys for simulation and initialisation streams from global host RNG
+        if(isCounterBasedRNGRequired(modelMerged)) {
+            os << "simRNGKey = hostRNG();" << std::endl;
+            os << "simRNGKey |= (uint64_t)hostRNG() << 32;" << std::endl;
+            os << "initRNGKey = hostRNG();" << std::endl;
+            os << "initRNGKey |= (uint64_t)hostRNG() << 32;" << std::endl;
+        }
+
+        // If procedural connectivity requires counter-based RNG streams, generate key for them from global host RNG
+        if(isProceduralRNGStreamRequired(modelMerged)) {
+            os << "proceduralRNGKey = hostRNG();" << std::endl;
+            os << "proceduralRNGKey |= (uint64_t)hostRNG() << 32;" << std::endl;
+        }
+
+        // **NOTE** each group is given a unique index so counter-based RNG streams can be unique to each group
+        size_t initRNGGroupIndex = 0;
+
         os << "// ------------------------------------------------------------------------" << std::endl;
         os << "// Neuron groups" << std::endl;
         for(const auto &n : modelMerged.getMergedNeuronInitGroups()) {
@@ -796,8 +1101,10 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                 // Get reference to group
                 os << "const auto *group = &mergedNeuronInitGroup" << n.getIndex() << "[g]; " << std::endl;
                 Substitutions popSubs(&funcSubs);
+                genInitRNGSiteCounter(os, popSubs, initRNGGroupIndex);
                 n.generateInit(*this, os, modelMerged, popSubs);
             }
+            initRNGGroupIndex += n.getGroups().size();
         }
         
         os << "// ------------------------------------------------------------------------" << std::endl;
@@ -814,6 +1121,7 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                 Substitutions popSubs(&funcSubs);
                 s.generateInit(*this, os, modelMerged, popSubs);
             }
+            initRNGGroupIndex += s.getGroups().size();
         }
 
         os << "// ------------------------------------------------------------------------" << std::endl;
@@ -828,8 +1136,10 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                 // Get reference to group
                 os << "const auto *group = &mergedCustomUpdateInitGroup" <<c.getIndex() << "[g]; " << std::endl;
                 Substitutions popSubs(&funcSubs);
+                genInitRNGSiteCounter(os, popSubs, initRNGGroupIndex);
                 c.generateInit(*this, os, modelMerged, popSubs);
             }
+            initRNGGroupIndex += c.getGroups().size();
         }
 
         os << "// ------------------------------------------------------------------------" << std::endl;
@@ -846,10 +1156,21 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                 Substitutions popSubs(&funcSubs);
                 c.generateInit(*this, os, modelMerged, popSubs);
             }
+            initRNGGroupIndex += c.getGroups().size();
         }
 
         os << "// ------------------------------------------------------------------------" << std::endl;
         os << "// Synapse sparse connectivity" << std::endl;
+
+        // If connectivity initialisation requires counter-based RNG streams, generate key for them from global host RNG
+        const bool parallelConnectivityInit = getPreferences<Preferences>().enableParallelConnectivityInit;
+        if(isConnectivityInitRNGStreamRequired(modelMerged)) {
+            os << "uint64_t connectivityRNGKey = hostRNG();" << std::endl;
+            os << "connectivityRNGKey |= (uint64_t)hostRNG() << 32;" << std::endl;
+        }
+
+        // **NOTE** each group is given a unique index so counter-based RNG streams can be unique to each row or column
+        size_t connectivityGroupIndex = 0;
         for(const auto &s : modelMerged.getMergedSynapseConnectivityInitGroups()) {
             CodeStream::Scope b(os);
             os << "// merged synapse connectivity init group " << s.getIndex() << std::endl;
@@ -876,8 +1197,25 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                 // If there is row-building code in this snippet
                 Substitutions popSubs(&funcSubs);
                 const auto *snippet = s.getArchetype().getConnectivityInitialiser().getSnippet();
-                if(!snippet->getRowBuildCode().empty()) {
+                const bool bitmask = (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK);
+                const bool rowBuild = !snippet->getRowBuildCode().empty();
+                const bool deltaEncoded = s.getArchetype().isDeltaEncodedSparseIndEnabled();
+                assert(!deltaEncoded || rowBuild);
+
+                // Rows can always be built in parallel but, as columns are built by inserting synapses into rows,
+                // they can only be built in parallel if rows are subsequently sorted which isn't possible with kernel variables
+                const bool parallel = parallelConnectivityInit && (rowBuild || bitmask || s.getArchetype().getKernelSize().empty());
+
+                // If sparse indices are delta-encoded, declare flag to record rows built out of order
+                // **NOTE** exceptions cannot be thrown from parallel regions so this is checked after all rows are built
+                if(deltaEncoded) {
+                    os << "uint32_t indDeltaOrderFailed = 0;" << std::endl;
+                }
+                if(rowBuild) {
                     // Generate loop through source neurons
+                    if(parallel) {
+                        genParallelForPreamble(os);
+                    }
                     os << "for (unsigned int i = 0; i < group->numSrcNeurons; i++)";
 
                     // Configure substitutions
@@ -893,6 +1231,9 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                     assert(!snippet->getColBuildCode().empty());
 
                     // Loop through target neurons
+                    if(parallel) {
+                        genParallelForPreamble(os);
+                    }
                     os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
 
                     // Configure substitutions
@@ -906,6 +1247,19 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                 {
                     CodeStream::Scope b(os);
 
+                    // If parallel connectivity initialisation is enabled and RNG is required, use counter-based RNG stream for this row or column
+                    if(parallelConnectivityInit && isConnectivityInitRNGRequired(s.getArchetype())) {
+                        genCounterBasedRNGStream(os, popSubs, model.getPrecision(), "connectivity", "connectivityRNGKey",
+                                                 rowBuild ? "i" : "j", std::to_string(connectivityGroupIndex) + " + g", "0");
+                    }
+
+                    // If sparse indices are delta-encoded, point encoder at start of row
+                    if(deltaEncoded) {
+                        os << "uint8_t *indDeltaPtr = &group->indDelta[(size_t)i * group->indDeltaStride];" << std::endl;
+                        os << "unsigned int indDeltaPrev = 0;" << std::endl;
+                        os << "bool indDeltaRowFailed = false;" << std::endl;
+                    }
+
                     // Create new stream to generate addSynapse function which initializes all kernel variables
                     std::ostringstream kernelInitStream;
                     CodeStream kernelInit(kernelInitStream);
@@ -920,6 +1274,10 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                             if(!snippet->getRowBuildCode().empty()) {
                                 kernelInit << "const unsigned int idx = " << "(" + popSubs["id_pre"] + " * group->rowStride) + group->rowLength[i];" << std::endl;
                             }
+                            // **NOTE** if columns are built in parallel, row lengths are shared between iterations
+                            else if(parallel) {
+                                kernelInit << "const unsigned int idx = " << "(($(0)) * group->rowStride) + " << getSharedIncrement("group->rowLength[$(0)]") << ";" << std::endl;
+                            }
                             else {
                                 kernelInit << "const unsigned int idx = " << "(($(0)) * group->rowStride) + group->rowLength[$(0)];" << std::endl;
                             }
@@ -956,10 +1314,34 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                         if(!snippet->getRowBuildCode().empty()) {
                             // If matrix is sparse, add function to increment row length and insert synapse into ind array
                             if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                kernelInit << "group->ind[idx] = $(0);" << std::endl;
-                                kernelInit << "group->rowLength[i]++;" << std::endl;
+                                // If sparse indices are delta-encoded, encode difference from previous synapse in row
+                                // **NOTE** deltas are unsigned so rows must be built in ascending order - once
+                                // a synapse is added out of order, the rest of the row is ignored and the row flagged
+                                if(deltaEncoded) {
+                                    kernelInit << "if(indDeltaRowFailed || ($(0)) < indDeltaPrev)";
+                                    {
+                                        CodeStream::Scope b(kernelInit);
+                                        kernelInit << "indDeltaRowFailed = true;" << std::endl;
+                                    }
+                                    kernelInit << "else";
+                                    {
+                                        CodeStream::Scope b(kernelInit);
+                                        kernelInit << "gennEncodeIndDelta(indDeltaPtr, ($(0)) - indDeltaPrev);" << std::endl;
+                                        kernelInit << "indDeltaPrev = ($(0));" << std::endl;
+                                        kernelInit << "group->rowLength[i]++;" << std::endl;
+                                    }
+                                }
+                                else {
+                                    kernelInit << "group->ind[idx] = $(0);" << std::endl;
+                                    kernelInit << "group->rowLength[i]++;" << std::endl;
+                                }
                             }
                             // Otherwise, add function to set correct bit in bitmask
+                            // **NOTE** if rows are built in parallel, bitmask words may be shared between rows
+                            else if(parallel) {
+                                kernelInit << "const int64_t rowStartGID = i * group->rowStride;" << std::endl;
+                                kernelInit << getSharedBitSet("group->gp[(rowStartGID + ($(0))) / 32]", "(0x80000000 >> ((rowStartGID + ($(0))) & 31))") << ";" << std::endl;
+                            }
                             else {
                                 kernelInit << "const int64_t rowStartGID = i * group->rowStride;" << std::endl;
                                 kernelInit << "setB(group->gp[(rowStartGID + ($(0))) / 32], (rowStartGID + $(0)) & 31);" << std::endl;
@@ -970,7 +1352,14 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                             // If matrix is sparse, add function to increment row length and insert synapse into ind array
                             if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
                                 kernelInit << "group->ind[idx] = " << popSubs["id_post"] << ";" << std::endl;
-                                kernelInit << "group->rowLength[$(0)]++;" << std::endl;
+                                if(!parallel) {
+                                    kernelInit << "group->rowLength[$(0)]++;" << std::endl;
+                                }
+                            }
+                            // **NOTE** if columns are built in parallel, bitmask words are shared between columns
+                            else if(parallel) {
+                                kernelInit << "const int64_t colStartGID = j;" << std::endl;
+                                kernelInit << getSharedBitSet("group->gp[(colStartGID + (($(0)) * group->rowStride)) / 32]", "(0x80000000 >> ((colStartGID + (($(0)) * group->rowStride)) & 31))") << ";" << std::endl;
                             }
                             else {
                                 kernelInit << "const int64_t colStartGID = j;" << std::endl;
@@ -990,8 +1379,37 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                     else {
                         s.generateSparseColumnInit(*this, os, modelMerged, popSubs);
                     }
+
+                    // If this row was built out of order, set shared flag
+                    if(deltaEncoded) {
+                        os << "if(indDeltaRowFailed)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << getSharedBitSet("indDeltaOrderFailed", "1") << ";" << std::endl;
+                        }
+                    }
+                }
+
+                // If any rows were built out of order, throw once all rows have been built
+                if(deltaEncoded) {
+                    os << "if(indDeltaOrderFailed)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "throw std::runtime_error(\"Rows of synapse groups with delta-encoded sparse indices must be built in ascending order\");" << std::endl;
+                    }
+                }
+
+                // If sparse connectivity was built from columns in parallel, sort rows so synapses are in the same order as if they were built serially
+                if(parallel && !rowBuild && (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE)) {
+                    genParallelForPreamble(os);
+                    os << "for (unsigned int i = 0; i < group->numSrcNeurons; i++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "std::sort(&group->ind[i * group->rowStride], &group->ind[(i * group->rowStride) + group->rowLength[i]]);" << std::endl;
+                    }
                 }
             }
+            connectivityGroupIndex += s.getGroups().size();
         }
     }
     os << std::endl;
@@ -1022,8 +1440,8 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                 // Get reference to group
                 os << "const auto *group = &mergedSynapseSparseInitGroup" << s.getIndex() << "[g]; " << std::endl;
 
-                // If postsynaptic learning is required, initially zero column lengths
-                if (!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
+                // If postsynaptic remapping is required, initially zero column lengths
+                if (isSynapseGroupPostsynapticRemapRequired(s.getArchetype())) {
                     os << "// Zero column lengths" << std::endl;
                     os << "std::fill_n(group->colLength, group->numTrgNeurons, 0);" << std::endl;
                 }
@@ -1041,19 +1459,30 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                         s.generateInit(*this, os, modelMerged, popSubs);
                     }
 
-                    // If postsynaptic learning is required
-                    if(!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
+                    // If postsynaptic remapping is required
+                    if(isSynapseGroupPostsynapticRemapRequired(s.getArchetype())) {
+                        // If sparse indices are delta-encoded, point decoder at start of row
+                        if(s.getArchetype().isDeltaEncodedSparseIndEnabled()) {
+                            os << "const uint8_t *indDeltaPtr = &group->indDelta[(size_t)i * group->indDeltaStride];" << std::endl;
+                            os << "unsigned int postIndex = 0;" << std::endl;
+                        }
                         os << "// Loop through synapses in corresponding matrix row" << std::endl;
                         os << "for(unsigned int j = 0; j < group->rowLength[i]; j++)" << std::endl;
                         {
                             CodeStream::Scope b(os);
 
-                            // If postsynaptic learning is required, calculate column length and remapping
-                            if(!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
+                            // If postsynaptic remapping is required, calculate column length and remapping
+                            if(isSynapseGroupPostsynapticRemapRequired(s.getArchetype())) {
                                 os << "// Calculate index of this synapse in the row-major matrix" << std::endl;
                                 os << "const unsigned int rowMajorIndex = (i * group->rowStride) + j;" << std::endl;
-                                os << "// Using this, lookup postsynaptic target" << std::endl;
-                                os << "const unsigned int postIndex = group->ind[rowMajorIndex];" << std::endl;
+                                if(s.getArchetype().isDeltaEncodedSparseIndEnabled()) {
+                                    os << "// Decode postsynaptic target from row" << std::endl;
+                                    os << "postIndex += gennDecodeIndDelta(indDeltaPtr);" << std::endl;
+                                }
+                                else {
+                                    os << "// Using this, lookup postsynaptic target" << std::endl;
+                                    os << "const unsigned int postIndex = group->ind[rowMajorIndex];" << std::endl;
+                                }
                                 os << "// From this calculate index of this synapse in the column-major matrix" << std::endl;
                                 os << "const unsigned int colMajorIndex = (postIndex * group->colStride) + group->colLength[postIndex];" << std::endl;
                                 os << "// Increment column length corresponding to this postsynaptic neuron" << std::endl;
@@ -1097,7 +1526,12 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
 //--------------------------------------------------------------------------
 size_t Backend::getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const
 {
-    if ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (sg.getMatrixType() & SynapseMatrixConnectivity::TOEPLITZ)) {
+    if (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+        // Pad row stride to alignment specified in preferences
+        const unsigned int alignment = getPreferences<Preferences>().sparseRowStrideAlignment;
+        return (alignment > 1) ? padSize(sg.getMaxConnections(), alignment) : sg.getMaxConnections();
+    }
+    else if (sg.getMatrixType() & SynapseMatrixConnectivity::TOEPLITZ) {
         return sg.getMaxConnections();
     }
     else if(getPreferences().enableBitmaskOptimisations && (sg.getMatrixType() & SynapseMatrixConnectivity::BITMASK)) {
@@ -1111,15 +1545,13 @@ size_t Backend::getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const
 void Backend::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
 {
     const ModelSpecInternal &model = modelMerged.getModel();
-    if(model.getBatchSize() != 1) {
-        throw std::runtime_error("The single-threaded CPU backend only supports simulations with a batch size of 1");
-    }
 
     os << "// Standard C++ includes" << std::endl;
     os << "#include <algorithm>" << std::endl;
     os << "#include <chrono>" << std::endl;
     os << "#include <iostream>" << std::endl;
     os << "#include <random>" << std::endl;
+    os << "#include <stdexcept>" << std::endl;
     os << std::endl;
     os << "// Standard C includes" << std::endl;
     os << "#include <cassert>" << std::endl;
@@ -1136,7 +1568,7 @@ void Backend::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &mode
     }
 }
 //--------------------------------------------------------------------------
-void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &) const
+void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
 {
     os << "#define SUPPORT_CODE_FUNC inline" << std::endl;
 
@@ -1169,6 +1601,166 @@ void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerg
     os << "#define gennCLZ __builtin_clz" << std::endl;
 #endif
     os << std::endl;
+
+    // If any sparse postsynaptic updates or gathered presynaptic updates need to divide by a row stride which varies between merged groups, generate
+    // functions to divide 32-bit numerators by runtime divisors using a precomputed 64-bit multiplier
+    // **NOTE** based on Lemire et al. (2019) "Faster remainder by direct computation", with the
+    // 64x32-bit high multiply split into 32x32-bit multiplies so it doesn't require 128-bit integers
+    if(std::any_of(modelMerged.getMergedPostsynapticUpdateGroups().cbegin(), modelMerged.getMergedPostsynapticUpdateGroups().cend(),
+                   [this](const PostsynapticUpdateGroupMerged &sg)
+                   {
+                       return ((sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) && !isRowStrideHomogeneous(sg));
+                   })
+       || std::any_of(modelMerged.getMergedPresynapticUpdateGroups().cbegin(), modelMerged.getMergedPresynapticUpdateGroups().cend(),
+                      [this](const PresynapticUpdateGroupMerged &sg)
+                      {
+                          return (isPostsynapticGatherRequired(sg.getArchetype()) && !isRowStrideHomogeneous(sg));
+                      }))
+    {
+        os << "inline uint64_t gennFastDivideMagic(uint32_t divisor)";
+        {
+            CodeStream::Scope b(os);
+            os << "// **NOTE** ceil(2^64 / 1) doesn't fit in 64 bits so division by 1 is handled seperately and" << std::endl;
+            os << "// groups with a row stride of zero have no synapses to divide so don't need a magic number" << std::endl;
+            os << "return (divisor <= 1) ? 0 : ((0xFFFFFFFFFFFFFFFFull / divisor) + 1);" << std::endl;
+        }
+        os << std::endl;
+        os << "inline uint32_t gennFastDivide(uint32_t numerator, uint64_t magic, uint32_t divisor)";
+        {
+            CodeStream::Scope b(os);
+            os << "if(divisor == 1)";
+            {
+                CodeStream::Scope b(os);
+                os << "return numerator;" << std::endl;
+            }
+            os << "const uint64_t lowProduct = ((magic & 0xFFFFFFFFull) * numerator) >> 32;" << std::endl;
+            os << "return (uint32_t)(((magic >> 32) * numerator + lowProduct) >> 32);" << std::endl;
+        }
+        os << std::endl;
+    }
+
+    // If any synapse groups store their sparse indices as deltas, generate functions to encode and decode them
+    // **NOTE** deltas are variable-byte encoded with 7 bits per byte, least significant first and the top bit
+    // of each byte set if more follow so the deltas between the typically close indices within a row fit in a byte
+    const ModelSpecInternal &model = modelMerged.getModel();
+    if(std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
+                   [](const ModelSpec::SynapseGroupValueType &s)
+                   {
+                       return s.second.isDeltaEncodedSparseIndEnabled();
+                   }))
+    {
+        os << "inline void gennEncodeIndDelta(uint8_t *&ptr, uint32_t delta)";
+        {
+            CodeStream::Scope b(os);
+            os << "while(delta >= 0x80)";
+            {
+                CodeStream::Scope b(os);
+                os << "*ptr++ = (uint8_t)(delta | 0x80);" << std::endl;
+                os << "delta >>= 7;" << std::endl;
+            }
+            os << "*ptr++ = (uint8_t)delta;" << std::endl;
+        }
+        os << std::endl;
+        os << "inline uint32_t gennDecodeIndDelta(const uint8_t *&ptr)";
+        {
+            CodeStream::Scope b(os);
+            os << "uint32_t delta = *ptr++;" << std::endl;
+            os << "if(delta & 0x80)";
+            {
+                CodeStream::Scope b(os);
+                os << "delta &= 0x7F;" << std::endl;
+                os << "for(unsigned int shift = 7;; shift += 7)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "const uint32_t byte = *ptr++;" << std::endl;
+                    os << "delta |= (byte & 0x7F) << shift;" << std::endl;
+                    os << "if(!(byte & 0x80))";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "break;" << std::endl;
+                    }
+                }
+            }
+            os << "return delta;" << std::endl;
+        }
+        os << std::endl;
+    }
+
+    // If connectivity initialisation, procedural connectivity, simulation or variable initialisation require
+    // counter-based RNG streams, generate Philox4x32-10 RNG which can be used with standard library distributions
+    if(isConnectivityInitRNGStreamRequired(modelMerged) || isProceduralRNGStreamRequired(modelMerged)
+       || isCounterBasedRNGRequired(modelMerged))
+    {
+        os << "class Philox4x32_10";
+        {
+            CodeStream::Scope b(os);
+            os << "public:" << std::endl;
+            os << "typedef uint32_t result_type;" << std::endl;
+            os << std::endl;
+            os << "Philox4x32_10(uint64_t key, uint32_t stream0, uint32_t stream1, uint32_t stream2)" << std::endl;
+            os << ":   m_Key{(uint32_t)key, (uint32_t)(key >> 32)}, m_Counter{0, stream0, stream1, stream2}, m_OutputIndex(4)" << std::endl;
+            os << "{" << std::endl;
+            os << "}" << std::endl;
+            os << std::endl;
+            os << "static constexpr result_type min(){ return 0; }" << std::endl;
+            os << "static constexpr result_type max(){ return 0xFFFFFFFFu; }" << std::endl;
+            os << std::endl;
+            os << "result_type operator()()";
+            {
+                CodeStream::Scope b(os);
+                os << "if(m_OutputIndex == 4)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "generate();" << std::endl;
+                    os << "m_OutputIndex = 0;" << std::endl;
+                }
+                os << "return m_Output[m_OutputIndex++];" << std::endl;
+            }
+            os << std::endl;
+            os << "private:" << std::endl;
+            os << "void generate()";
+            {
+                CodeStream::Scope b(os);
+                os << "uint32_t c[4] = {m_Counter[0], m_Counter[1], m_Counter[2], m_Counter[3]};" << std::endl;
+                os << "uint32_t k[2] = {m_Key[0], m_Key[1]};" << std::endl;
+                os << "for(unsigned int r = 0; r < 10; r++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "const uint64_t p0 = (uint64_t)0xD2511F53u * c[0];" << std::endl;
+                    os << "const uint64_t p1 = (uint64_t)0xCD9E8D57u * c[2];" << std::endl;
+                    os << "c[0] = (uint32_t)(p1 >> 32) ^ c[1] ^ k[0];" << std::endl;
+                    os << "c[1] = (uint32_t)p1;" << std::endl;
+                    os << "c[2] = (uint32_t)(p0 >> 32) ^ c[3] ^ k[1];" << std::endl;
+                    os << "c[3] = (uint32_t)p0;" << std::endl;
+                    os << "k[0] += 0x9E3779B9u;" << std::endl;
+                    os << "k[1] += 0xBB67AE85u;" << std::endl;
+                }
+                os << "std::copy(std::begin(c), std::end(c), std::begin(m_Output));" << std::endl;
+                os << std::endl;
+                os << "m_Counter[0]++;" << std::endl;
+            }
+            os << std::endl;
+            os << "uint32_t m_Key[2];" << std::endl;
+            os << "uint32_t m_Counter[4];" << std::endl;
+            os << "uint32_t m_Output[4];" << std::endl;
+            os << "unsigned int m_OutputIndex;" << std::endl;
+        }
+        os << ";" << std::endl;
+        os << std::endl;
+    }
+
+    // If counter-based RNG streams are required, declare keys shared between modules
+    if(isCounterBasedRNGRequired(modelMerged)) {
+        os << "extern uint64_t simRNGKey;" << std::endl;
+        os << "extern uint64_t initRNGKey;" << std::endl;
+        os << std::endl;
+    }
+
+    // If procedural connectivity requires counter-based RNG streams, declare key shared between modules
+    if(isProceduralRNGStreamRequired(modelMerged)) {
+        os << "extern uint64_t proceduralRNGKey;" << std::endl;
+        os << std::endl;
+    }
 }
 //--------------------------------------------------------------------------
 void Backend::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged, const MemAlloc&) const
@@ -1182,6 +1774,19 @@ void Backend::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerg
         os << "std::exponential_distribution<" << model.getPrecision() << "> standardExponentialDistribution(" << model.scalarExpr(1.0) << ");" << std::endl;
         os << std::endl;
     }
+
+    // If counter-based RNG streams are required, implement keys used to generate simulation and initialisation streams
+    if(isCounterBasedRNGRequired(modelMerged)) {
+        os << "uint64_t simRNGKey = 0;" << std::endl;
+        os << "uint64_t initRNGKey = 0;" << std::endl;
+        os << std::endl;
+    }
+
+    // If procedural connectivity requires counter-based RNG streams, implement key used to regenerate rows
+    if(isProceduralRNGStreamRequired(modelMerged)) {
+        os << "uint64_t proceduralRNGKey = 0;" << std::endl;
+        os << std::endl;
+    }
     os << std::endl;
 }
 //--------------------------------------------------------------------------
@@ -1281,14 +1886,37 @@ void Backend::genPopVariableInit(CodeStream &os, const Substitutions &kernelSubs
 void Backend::genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
                               const Substitutions &kernelSubs, Handler handler) const
 {
-     // **TODO** loops like this should be generated like CUDA threads
-    os << "for (unsigned i = 0; i < (" << count << "); i++)";
-    {
+    // If group has an initialisation site counter, give each element its own counter-based RNG stream,
+    // identified by the group, the element and the site, which is taken from the counter before the loop
+    if(kernelSubs.hasVarSubstitution("init_rng_site")) {
         CodeStream::Scope b(os);
+        os << "const uint32_t initRNGSite = " << kernelSubs["init_rng_site"] << "++;" << std::endl;
+        genParallelForPreamble(os);
+        os << "for (unsigned i = 0; i < (" << count << "); i++)";
+        {
+            CodeStream::Scope b(os);
 
-        Substitutions varSubs(&kernelSubs);
-        varSubs.addVarSubstitution(indexVarName, "i");
-        handler(os, varSubs);
+            Substitutions varSubs(&kernelSubs);
+            varSubs.addVarSubstitution(indexVarName, "i");
+            genCounterBasedRNGStream(os, varSubs, "scalar", "init", "initRNGKey", "i",
+                                     kernelSubs["init_rng_group"], "initRNGSite");
+            handler(os, varSubs);
+        }
+    }
+    else {
+        // **TODO** loops like this should be generated like CUDA threads
+        // **NOTE** iterations can only be run in parallel if they don't use the global host RNG
+        if(!kernelSubs.hasVarSubstitution("rng")) {
+            genParallelForPreamble(os);
+        }
+        os << "for (unsigned i = 0; i < (" << count << "); i++)";
+        {
+            CodeStream::Scope b(os);
+
+            Substitutions varSubs(&kernelSubs);
+            varSubs.addVarSubstitution(indexVarName, "i");
+            handler(os, varSubs);
+        }
     }
 }
 //--------------------------------------------------------------------------
@@ -1305,6 +1933,22 @@ void Backend::genSparseSynapseVariableRowInit(CodeStream &os, const Substitution
      }
 }
 //--------------------------------------------------------------------------
+void Backend::genDeltaEncodedSparseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const
+{
+    os << "const uint8_t *indDeltaPtr = &group->indDelta[(size_t)" << kernelSubs["id_pre"] << " * group->indDeltaStride];" << std::endl;
+    os << "unsigned int ipost = 0;" << std::endl;
+    os << "for (unsigned j = 0; j < group->rowLength[" << kernelSubs["id_pre"] << "]; j++)";
+    {
+        CodeStream::Scope b(os);
+        os << "ipost += gennDecodeIndDelta(indDeltaPtr);" << std::endl;
+
+        Substitutions varSubs(&kernelSubs);
+        varSubs.addVarSubstitution("id_syn", "(" + kernelSubs["id_pre"] + " * group->rowStride) + j");
+        varSubs.addVarSubstitution("id_post", "ipost");
+        handler(os, varSubs);
+     }
+}
+//--------------------------------------------------------------------------
 void Backend::genDenseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const
 {
     os << "for (unsigned j = 0; j < group->numTrgNeurons; j++)";
@@ -1338,6 +1982,12 @@ void Backend::genVariablePull(CodeStream&, const std::string&, const std::string
     assert(!getPreferences().automaticCopy);
 }
 //--------------------------------------------------------------------------
+void Backend::genVariableRangePull(CodeStream&, const std::string&, const std::string&, VarLocation,
+                                   const std::string&, const std::string&) const
+{
+    assert(!getPreferences().automaticCopy);
+}
+//--------------------------------------------------------------------------
 void Backend::genCurrentVariablePush(CodeStream &, const NeuronGroupInternal &, const std::string &, const std::string &, VarLocation, unsigned int) const
 {
     assert(!getPreferences().automaticCopy);
@@ -1465,6 +2115,54 @@ void Backend::genMSBuildImportTarget(std::ostream&) const
 {
 }
 //--------------------------------------------------------------------------
+void Backend::genCounterBasedRNGStream(CodeStream &os, Substitutions &subs, const std::string &precision, const std::string &name,
+                                       const std::string &key, const std::string &stream0, const std::string &stream1,
+                                       const std::string &stream2) const
+{
+    // Create RNG stream
+    os << "Philox4x32_10 " << name << "RNG(" << key << ", " << stream0 << ", " << stream1 << ", " << stream2 << ");" << std::endl;
+
+    // Create local standard distributions as global ones may cache state e.g. the second value generated by Box-Muller
+    os << "std::uniform_real_distribution<" << precision << "> " << name << "UniformDistribution(0, 1);" << std::endl;
+    os << "std::normal_distribution<" << precision << "> " << name << "NormalDistribution(0, 1);" << std::endl;
+    os << "std::exponential_distribution<" << precision << "> " << name << "ExponentialDistribution(1);" << std::endl;
+
+    // Override global host RNG and standard distributions
+    subs.addVarSubstitution("rng", name + "RNG");
+    subs.addFuncSubstitution("gennrand_uniform", 0, name + "UniformDistribution($(rng))");
+    subs.addFuncSubstitution("gennrand_normal", 0, name + "NormalDistribution($(rng))");
+    subs.addFuncSubstitution("gennrand_exponential", 0, name + "ExponentialDistribution($(rng))");
+}
+//--------------------------------------------------------------------------
+bool Backend::isConnectivityInitRNGStreamRequired(const ModelSpecMerged &modelMerged) const
+{
+    return (getPreferences<Preferences>().enableParallelConnectivityInit
+            && std::any_of(modelMerged.getMergedSynapseConnectivityInitGroups().cbegin(), modelMerged.getMergedSynapseConnectivityInitGroups().cend(),
+                           [](const SynapseConnectivityInitGroupMerged &s){ return isConnectivityInitRNGRequired(s.getArchetype()); }));
+}
+//--------------------------------------------------------------------------
+bool Backend::isProceduralRNGStreamRequired(const ModelSpecMerged &modelMerged) const
+{
+    return std::any_of(modelMerged.getMergedPresynapticUpdateGroups().cbegin(), modelMerged.getMergedPresynapticUpdateGroups().cend(),
+                       [](const PresynapticUpdateGroupMerged &s){ return PresynapticUpdateStrategy::RowScatterProcedural::isRNGRequired(s.getArchetype()); });
+}
+//--------------------------------------------------------------------------
+bool Backend::isCounterBasedRNGRequired(const ModelSpecMerged &modelMerged) const
+{
+    return (getPreferences<Preferences>().enableCounterBasedRNG && isGlobalHostRNGRequired(modelMerged));
+}
+//--------------------------------------------------------------------------
+void Backend::genInitRNGSiteCounter(CodeStream &os, Substitutions &popSubs, size_t initRNGGroupIndex) const
+{
+    // **NOTE** the counter is declared in the generated code so sites are numbered in the order they are
+    // generated within each group, starting from zero each time initialisation is run
+    if(getPreferences<Preferences>().enableCounterBasedRNG && popSubs.hasVarSubstitution("rng")) {
+        os << "uint32_t initRNGSiteCounter = 0;" << std::endl;
+        popSubs.addVarSubstitution("init_rng_site", "initRNGSiteCounter");
+        popSubs.addVarSubstitution("init_rng_group", std::to_string(initRNGGroupIndex) + " + g");
+    }
+}
+//--------------------------------------------------------------------------
 bool Backend::isGlobalHostRNGRequired(const ModelSpecMerged &modelMerged) const
 {
     // If any neuron groups require simulation RNGs or require RNG for initialisation, return true
@@ -1483,7 +2181,7 @@ bool Backend::isGlobalHostRNGRequired(const ModelSpecMerged &modelMerged) const
     if(std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
                    [](const ModelSpec::SynapseGroupValueType &s)
                    {
-                       return (s.second.isWUInitRNGRequired() || s.second.isHostInitRNGRequired());
+                       return (s.second.isWUInitRNGRequired() || s.second.isHostInitRNGRequired() || PresynapticUpdateStrategy::RowScatterProcedural::isRNGRequired(s.second));
                    }))
     {
         return true;
@@ -1535,302 +2233,190 @@ boost::uuids::detail::sha1::digest_type Backend::getHashDigest() const
     return hash.get_digest();
 }
 //--------------------------------------------------------------------------
+bool Backend::isPostsynapticGatherRequired(const SynapseGroupInternal &sg) const
+{
+    return ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) && sg.isPostsynapticGatherEnabled());
+}
+//--------------------------------------------------------------------------
+bool Backend::isRowStrideHomogeneous(const SynapseGroupMergedBase &sg) const
+{
+    const size_t archetypeRowStride = getSynapticMatrixRowStride(sg.getArchetype());
+    return std::all_of(sg.getGroups().cbegin(), sg.getGroups().cend(),
+                       [archetypeRowStride, this](const SynapseGroupInternal &g)
+                       {
+                           return (getSynapticMatrixRowStride(g) == archetypeRowStride);
+                       });
+}
+//--------------------------------------------------------------------------
+bool Backend::canProcessRowsInParallel(const SynapseGroupInternal &sg, const std::string &code)
+{
+    return canProcessInParallel(sg, code, true);
+}
+//--------------------------------------------------------------------------
+bool Backend::canProcessColumnsInParallel(const SynapseGroupInternal &sg, const std::string &code)
+{
+    return canProcessInParallel(sg, code, false);
+}
+//--------------------------------------------------------------------------
 void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg, const Substitutions &popSubs, bool trueSpike) const
 {
-    // Get suffix based on type of events
-    const std::string eventSuffix = trueSpike ? "" : "Evnt";
-    const auto *wu = sg.getArchetype().getWUModel();
-
-    if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::TOEPLITZ) {
-        const auto &connectInit = sg.getArchetype().getToeplitzConnectivityInitialiser();
-
-        // Loop through Toeplitz matrix diagonals
-        os << "for(unsigned int j = 0; j < group->rowStride; j++)";
-        {
-            CodeStream::Scope b(os);
-
-            // Create substitution stack for generating procedural connectivity code
-            Substitutions connSubs(&popSubs);
-            connSubs.addVarSubstitution("id_diag", "j");
-
-            // Add substitutions
-            connSubs.addParamValueSubstitution(connectInit.getSnippet()->getParamNames(), connectInit.getParams(),
-                                               [&sg](size_t i) { return sg.isToeplitzConnectivityInitParamHeterogeneous(i);  },
-                                               "", "group->");
-            connSubs.addVarValueSubstitution(connectInit.getSnippet()->getDerivedParams(), connectInit.getDerivedParams(),
-                                             [&sg](size_t i) { return sg.isToeplitzConnectivityInitDerivedParamHeterogeneous(i);  },
-                                             "", "group->");
-            connSubs.addVarNameSubstitution(connectInit.getSnippet()->getExtraGlobalParams(), "", "group->");
-            connSubs.addVarNameSubstitution(connectInit.getSnippet()->getDiagonalBuildStateVars());
-
-            // Initialise any diagonal build state variables defined
-            for (const auto &d : connectInit.getSnippet()->getDiagonalBuildStateVars()) {
-                // Apply substitutions to value
-                std::string value = d.value;
-                connSubs.applyCheckUnreplaced(value, "toeplitz diagonal build state var : merged" + std::to_string(sg.getIndex()));
-                value = ensureFtype(value, modelMerged.getModel().getPrecision());
-
-                os << d.type << " " << d.name << " = " << value << ";" << std::endl;
-            }
-
-             // Detect spike events or spikes and do the update
-            os << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
-            if(sg.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
-                os << "for (unsigned int i = 0; i < group->srcSpkCnt" << eventSuffix << "[preDelaySlot]; i++)";
-            }
-            else {
-                os << "for (unsigned int i = 0; i < group->srcSpkCnt" << eventSuffix << "[0]; i++)";
-            }
-            {
-                CodeStream::Scope b(os);
-
-                const std::string queueOffset = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "preDelayOffset + " : "";
-                os << "const unsigned int ipre = group->srcSpk" << eventSuffix << "[" << queueOffset << "i];" << std::endl;
-
-                // Create another substitution stack for generating presynaptic simulation code
-                Substitutions presynapticUpdateSubs(&popSubs);
-                connSubs.addVarSubstitution("id_pre", "ipre");
-                presynapticUpdateSubs.addVarSubstitution("id_pre", "ipre");
-
-                if(!wu->getSimSupportCode().empty()) {
-                    os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) << ";" << std::endl;
-                }
-
-                // If this is a spike-like event, insert threshold check for this presynaptic neuron
-                if(!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
-                    os << "if(";
-
-                    // Generate weight update threshold condition
-                    sg.generateSpikeEventThreshold(*this, os, modelMerged, presynapticUpdateSubs);
-
-                    os << ")";
-                    os << CodeStream::OB(10);
-                }
-
-                // Replace $(id_post) with first 'function' parameter as simulation code is
-                // going to be, in turn, substituted into procedural connectivity generation code
-                presynapticUpdateSubs.addVarSubstitution("id_post", "$(0)");
-
-                // Replace kernel indices with the subsequent 'function' parameters
-                for(size_t i = 0; i < sg.getArchetype().getKernelSize().size(); i++) {
-                    presynapticUpdateSubs.addVarSubstitution("id_kernel_" + std::to_string(i),
-                                                             "$(" + std::to_string(i + 1) + ")");
-                }
-
-                if(sg.getArchetype().isDendriticDelayRequired()) {
-                    presynapticUpdateSubs.addFuncSubstitution("addToInSynDelay", 2, "group->denDelay[" + sg.getPostDenDelayIndex(1, "$(id_post)", "$(1)") + "] += $(0)");
-                }
-                else {
-                    presynapticUpdateSubs.addFuncSubstitution("addToInSyn", 1, "group->inSyn[" + sg.getPostISynIndex(1, "$(id_post)") + "] += $(0)");
-                }
-
-                if(sg.getArchetype().isPresynapticOutputRequired()) {
-                    presynapticUpdateSubs.addFuncSubstitution("addToPre", 1, "group->revInSyn[" + sg.getPreISynIndex(1, "ipre") + "] += $(0)");
-                }
-
-                // Generate presynaptic simulation code into new stringstream-backed code stream
-                std::ostringstream presynapticUpdateStream;
-                CodeStream presynapticUpdate(presynapticUpdateStream);
-                if(trueSpike) {
-                    sg.generateSpikeUpdate(*this, presynapticUpdate, modelMerged, presynapticUpdateSubs);
-                }
-                else {
-                    sg.generateSpikeEventUpdate(*this, presynapticUpdate, modelMerged, presynapticUpdateSubs);
-                }
-
-                // When a synapse should be 'added', substitute in presynaptic update code
-                connSubs.addFuncSubstitution("addSynapse", 1 + (unsigned int)sg.getArchetype().getKernelSize().size(), presynapticUpdateStream.str());
-
-                // Generate toeplitz connectivity code
-                sg.generateToeplitzConnectivity(*this, os, modelMerged, connSubs);
-
-                if(!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
-                    os << CodeStream::CB(130); // end if (eCode)
-                }
-            }
+    getPresynapticUpdateStrategy(sg.getArchetype(), trueSpike)->genUpdate(os, modelMerged, sg, popSubs, *this, trueSpike);
+}
+//--------------------------------------------------------------------------
+const PresynapticUpdateStrategy::Base *Backend::getPresynapticUpdateStrategy(const SynapseGroupInternal &sg, bool trueSpike) const
+{
+    // Loop through presynaptic update strategies until we find one that is compatible with this synapse group
+    // **NOTE** this is done backwards so that the most preferred strategies get first priority
+    for(auto s = s_PresynapticUpdateStrategies.rbegin(); s != s_PresynapticUpdateStrategies.rend(); ++s) {
+        if((*s)->isCompatible(sg, getPreferences<Preferences>(), trueSpike)) {
+            return s->get();
         }
     }
-    else {
-        // Detect spike events or spikes and do the update
-        os << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
-        if(sg.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
-            os << "for (unsigned int i = 0; i < group->srcSpkCnt" << eventSuffix << "[preDelaySlot]; i++)";
+
+    throw std::runtime_error("Unable to find a suitable presynaptic update strategy for synapse group '" + sg.getName() + "'");
+}
+//--------------------------------------------------------------------------
+void Backend::genNeuronUpdateLoop(CodeStream &os, const NeuronUpdateGroupMerged &ng, unsigned int batchSize, 
+                                  const Substitutions &popSubs, Handler handler) const
+{
+    genNeuronUpdateRange(os, ng, batchSize, popSubs, "0", "group->numNeurons", handler);
+}
+//--------------------------------------------------------------------------
+std::string Backend::getSpikeQueueWriteIndex(const NeuronUpdateGroupMerged &ng, unsigned int batchSize, bool trueSpike) const
+{
+    return getSpikeCount(ng, batchSize, trueSpike) + "++";
+}
+//--------------------------------------------------------------------------
+std::string Backend::getSpikeCount(const NeuronUpdateGroupMerged &ng, unsigned int batchSize, bool trueSpike) const
+{
+    const std::string suffix = trueSpike ? "" : "Evnt";
+    if(isSpikeDelayRequired(ng, trueSpike)) { // WITH DELAY
+        if(batchSize > 1) {
+            return "group->spkCnt" + suffix + "[*group->spkQuePtr + (batch * " + std::to_string(ng.getArchetype().getNumDelaySlots()) + ")]";
         }
         else {
-            os << "for (unsigned int i = 0; i < group->srcSpkCnt" << eventSuffix << "[0]; i++)";
+            return "group->spkCnt" + suffix + "[*group->spkQuePtr]";
         }
-        {
-            CodeStream::Scope b(os);
-            if(!wu->getSimSupportCode().empty()) {
-                os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) << ";" << std::endl;
-            }
-
-            const std::string queueOffset = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "preDelayOffset + " : "";
-            os << "const unsigned int ipre = group->srcSpk" << eventSuffix << "[" << queueOffset << "i];" << std::endl;
-
-            // If this is a spike-like event, insert threshold check for this presynaptic neuron
-            if(!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
-                os << "if(";
-
-                Substitutions threshSubs(&popSubs);
-                threshSubs.addVarSubstitution("id_pre", "ipre");
-
-                // Generate weight update threshold condition
-                sg.generateSpikeEventThreshold(*this, os, modelMerged, threshSubs);
-
-                os << ")";
-                os << CodeStream::OB(10);
-            }
+    }
+    else { // NO DELAY
+        return "group->spkCnt" + suffix + "[" + ((batchSize > 1) ? "batch" : "0") + "]";
+    }
+}
+//--------------------------------------------------------------------------
+std::string Backend::getSpikeQueueOffset(const NeuronUpdateGroupMerged &ng, unsigned int batchSize, bool trueSpike) const
+{
+    return ng.getWriteVarIndex(isSpikeDelayRequired(ng, trueSpike), batchSize, VarAccessDuplication::DUPLICATE, "");
+}
+//--------------------------------------------------------------------------
+void Backend::genNeuronUpdateRange(CodeStream &os, const NeuronUpdateGroupMerged &ng, unsigned int batchSize, const Substitutions &popSubs,
+                                   const std::string &start, const std::string &end, Handler handler) const
+{
+    const bool splitNeuronUpdate = getPreferences<Preferences>().enableSplitNeuronUpdate;
+    const bool spikeEventRequired = ng.getArchetype().isSpikeEventRequired();
+    if(splitNeuronUpdate) {
+        // Determine size of largest group in merged group
+        const auto maxGroup = std::max_element(ng.getGroups().cbegin(), ng.getGroups().cend(),
+                                               [](const NeuronGroupInternal &a, const NeuronGroupInternal &b)
+                                               {
+                                                   return (a.getNumNeurons() < b.getNumNeurons());
+                                               });
+        const unsigned int maxNeurons = maxGroup->get().getNumNeurons();
 
-            Substitutions synSubs(&popSubs);
-            synSubs.addVarSubstitution("id_pre", "ipre");
-            synSubs.addVarSubstitution("id_post", "ipost");
-            synSubs.addVarSubstitution("id_syn", "synAddress");
+        // Allocate (once) arrays to flag which neurons have spiked
+        os << "static uint8_t spkMask[" << maxNeurons << "];" << std::endl;
+        if(spikeEventRequired) {
+            os << "static uint8_t spkMaskEvnt[" << maxNeurons << "];" << std::endl;
+        }
+    }
 
-            if(sg.getArchetype().isDendriticDelayRequired()) {
-                synSubs.addFuncSubstitution("addToInSynDelay", 2, "group->denDelay[" + sg.getPostDenDelayIndex(1, "ipost", "$(1)") + "] += $(0)");
-            }
-            else {
-                synSubs.addFuncSubstitution("addToInSyn", 1, "group->inSyn[" + sg.getPostISynIndex(1, "ipost") + "] += $(0)");
-            }
+    os << "for(unsigned int i = " << start << "; i < " << end << "; i++)";
+    {
+        CodeStream::Scope b(os);
 
-            if(sg.getArchetype().isPresynapticOutputRequired()) {
-                synSubs.addFuncSubstitution("addToPre", 1, "group->revInSyn[" + sg.getPreISynIndex(1, synSubs["id_pre"]) + "] += $(0)");
+        // Clear spike flags
+        // **NOTE** unconditionally writing flags lets the conditional writes in the update be converted to selects
+        if(splitNeuronUpdate) {
+            os << "spkMask[i] = 0;" << std::endl;
+            if(spikeEventRequired) {
+                os << "spkMaskEvnt[i] = 0;" << std::endl;
             }
+        }
 
-            if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                os << "const unsigned int npost = group->rowLength[ipre];" << std::endl;
-                os << "for (unsigned int j = 0; j < npost; j++)";
-                {
-                    CodeStream::Scope b(os);
-
-                    // **TODO** seperate stride from max connection
-                    os << "const unsigned int synAddress = (ipre * group->rowStride) + j;" << std::endl;
-                    os << "const unsigned int ipost = group->ind[synAddress];" << std::endl;
+        Substitutions neuronSubs(&popSubs);
+        neuronSubs.addVarSubstitution("id", "i");
+        handler(os, neuronSubs);
+    }
 
-                    if(trueSpike) {
-                        sg.generateSpikeUpdate(*this, os, modelMerged, synSubs);
-                    }
-                    else {
-                        sg.generateSpikeEventUpdate(*this, os, modelMerged, synSubs);
-                    }
-                }
-            }
-            else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) {
-                throw std::runtime_error("The single-threaded CPU backend does not support procedural connectivity.");
-            }
-            else if(getPreferences().enableBitmaskOptimisations && (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK)) {
-                // Determine the number of words in each row
-                os << "const unsigned int rowWords = ((group->numTrgNeurons + 32 - 1) / 32);" << std::endl;
-                os << "for(unsigned int w = 0; w < rowWords; w++)";
+    // If neuron update is split, loop through range again emitting flagged spikes
+    if(splitNeuronUpdate) {
+        os << "for(unsigned int i = " << start << "; i < " << end << "; i++)";
+        {
+            CodeStream::Scope b(os);
+            if(spikeEventRequired) {
+                os << "if(spkMaskEvnt[i])";
                 {
                     CodeStream::Scope b(os);
-
-                    // Read row word
-                    os << "uint32_t connectivityWord = group->gp[(ipre * rowWords) + w];" << std::endl;
-
-                    // Set ipost to first synapse in connectivity word
-                    os << "unsigned int ipost = w * 32;" << std::endl;
-
-                    // While there any bits left
-                    os << "while(connectivityWord != 0)";
-                    {
-                        CodeStream::Scope b(os);
-
-                        // Cound leading zeros (as bits are indexed backwards this is index of next synapse)
-                        os << "const int numLZ = gennCLZ(connectivityWord);" << std::endl;
-
-                        // Shift off zeros and the one just discovered
-                        // **NOTE** << 32 appears to result in undefined behaviour
-                        os << "connectivityWord = (numLZ == 31) ? 0 : (connectivityWord << (numLZ + 1));" << std::endl;
-
-                        // Add to ipost
-                        os << "ipost += numLZ;" << std::endl;
-
-                        // If we aren't in padding region
-                        // **TODO** don't bother checking if there is no padding
-                        os << "if(ipost < group->numTrgNeurons)";
-                        {
-                            CodeStream::Scope b(os);
-                            if(trueSpike) {
-                                sg.generateSpikeUpdate(*this, os, modelMerged, synSubs);
-                            }
-                            else {
-                                sg.generateSpikeEventUpdate(*this, os, modelMerged, synSubs);
-                            }
-                        }
-
-                        // Increment ipost to take into account fact the next CLZ will go from bit AFTER synapse
-                        os << "ipost++;" << std::endl;
+                    genWriteSpike(os, ng, "i", batchSize, false);
+                    if(ng.getArchetype().isSpikeEventRecordingEnabled()) {
+                        genRecordSpike(os, "i", batchSize, false);
                     }
                 }
             }
-            // Otherwise (DENSE or BITMASK)
-            else {
-                os << "for (unsigned int ipost = 0; ipost < group->numTrgNeurons; ipost++)";
-                {
-                    CodeStream::Scope b(os);
-
-                    if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
-                        os << "const uint64_t gid = (ipre * (uint64_t)group->numTrgNeurons + ipost);" << std::endl;
-                        os << "if (B(group->gp[gid / 32], gid & 31))" << CodeStream::OB(20);
-                    }
-
-                    os << "const unsigned int synAddress = (ipre * group->numTrgNeurons) + ipost;" << std::endl;
-
-                    if(trueSpike) {
-                        sg.generateSpikeUpdate(*this, os, modelMerged, synSubs);
-                    }
-                    else {
-                        sg.generateSpikeEventUpdate(*this, os, modelMerged, synSubs);
-                    }
-
-                    if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
-                        os << CodeStream::CB(20);
-                    }
+            os << "if(spkMask[i])";
+            {
+                CodeStream::Scope b(os);
+                genWriteSpike(os, ng, "i", batchSize, true);
+                if(ng.getArchetype().isSpikeRecordingEnabled()) {
+                    genRecordSpike(os, "i", batchSize, true);
                 }
             }
-            // If this is a spike-like event, close braces around threshold check
-            if(!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
-                os << CodeStream::CB(10);
-            }
         }
     }
 }
 //--------------------------------------------------------------------------
-void Backend::genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, bool trueSpike, bool recordingEnabled) const
+void Backend::genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, 
+                           unsigned int batchSize, bool trueSpike, bool recordingEnabled) const
 {
-    // Determine if delay is required and thus, at what offset we should write into the spike queue
-    const bool spikeDelayRequired = trueSpike ? (ng.getArchetype().isDelayRequired() && ng.getArchetype().isTrueSpikeRequired()) : ng.getArchetype().isDelayRequired();
-    const std::string spikeQueueOffset = spikeDelayRequired ? "writeDelayOffset + " : "";
-
-    const std::string suffix = trueSpike ? "" : "Evnt";
-    os << "group->spk" << suffix << "[" << spikeQueueOffset << "group->spkCnt" << suffix;
-    if(spikeDelayRequired) { // WITH DELAY
-        os << "[*group->spkQuePtr]++]";
+    // If neuron update is split, flag neuron as having spiked so spike can be emitted after update
+    // Otherwise, write spike to spike queue
+    const bool splitNeuronUpdate = getPreferences<Preferences>().enableSplitNeuronUpdate;
+    if(splitNeuronUpdate) {
+        os << "spkMask" << (trueSpike ? "" : "Evnt") << "[" << subs["id"] << "] = 1;" << std::endl;
     }
-    else { // NO DELAY
-        os << "[0]++]";
+    else {
+        genWriteSpike(os, ng, subs["id"], batchSize, trueSpike);
     }
-    os << " = " << subs["id"] << ";" << std::endl;
 
     // Reset spike and spike-like-event times
-    const std::string queueOffset = ng.getArchetype().isDelayRequired() ? "writeDelayOffset + " : "";
+    const std::string timeIndex = ng.getWriteVarIndex(ng.getArchetype().isDelayRequired(), batchSize, VarAccessDuplication::DUPLICATE, subs["id"]);
     if(trueSpike && ng.getArchetype().isSpikeTimeRequired()) {
-        os << "group->sT[" << queueOffset << subs["id"] << "] = " << subs["t"] << ";" << std::endl;
+        os << "group->sT[" << timeIndex << "] = " << subs["t"] << ";" << std::endl;
     }
     else if(!trueSpike && ng.getArchetype().isSpikeEventTimeRequired()) {
-        os << "group->seT[" << queueOffset << subs["id"] << "] = " << subs["t"] << ";" << std::endl;
+        os << "group->seT[" << timeIndex << "] = " << subs["t"] << ";" << std::endl;
     }
     
     // If recording is enabled
-    if(recordingEnabled) {
-        const std::string recordSuffix = trueSpike ? "" : "Event";
-        os << "group->recordSpk" << recordSuffix << "[(recordingTimestep * numRecordingWords) + (" << subs["id"] << " / 32)]";
-        os << " |= (1 << (" << subs["id"] << " % 32));" << std::endl;
+    if(recordingEnabled && !splitNeuronUpdate) {
+        genRecordSpike(os, subs["id"], batchSize, trueSpike);
     }
 }
 //--------------------------------------------------------------------------
+void Backend::genWriteSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const std::string &id, 
+                            unsigned int batchSize, bool trueSpike) const
+{
+    const std::string suffix = trueSpike ? "" : "Evnt";
+    os << "group->spk" << suffix << "[" << getSpikeQueueOffset(ng, batchSize, trueSpike) << getSpikeQueueWriteIndex(ng, batchSize, trueSpike) << "]";
+    os << " = " << id << ";" << std::endl;
+}
+//--------------------------------------------------------------------------
+void Backend::genRecordSpike(CodeStream &os, const std::string &id, unsigned int batchSize, bool trueSpike) const
+{
+    const std::string recordSuffix = trueSpike ? "" : "Event";
+    os << "group->recordSpk" << recordSuffix << "[(" << getRecordingWordOffset(batchSize) << ") + (" << id << " / 32)]";
+    os << " |= (1 << (" << id << " % 32));" << std::endl;
+}
+//--------------------------------------------------------------------------
 void Backend::genWriteBackReductions(CodeStream &os, const CustomUpdateGroupMerged &cg, const std::string &idx) const
 {
     genWriteBackReductions(os, cg, idx,
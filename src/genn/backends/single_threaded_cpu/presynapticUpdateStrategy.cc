@@ -0,0 +1,669 @@
+#include "presynapticUpdateStrategy.h"
+
+// Standard C++ includes
+#include <algorithm>
+#include <iterator>
+
+// Standard C includes
+#include <cctype>
+
+// GeNN includes
+#include "gennUtils.h"
+#include "logging.h"
+
+// GeNN code generator includes
+#include "code_generator/codeGenUtils.h"
+#include "code_generator/codeStream.h"
+#include "code_generator/groupMerged.h"
+#include "code_generator/modelSpecMerged.h"
+#include "code_generator/substitutions.h"
+
+// Single-threaded CPU backend includes
+#include "backend.h"
+
+using namespace CodeGenerator;
+using namespace CodeGenerator::SingleThreadedCPU;
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+//! Number of postsynaptic neurons in each tile processed by tiled dense presynaptic updates
+const unsigned int denseTileSize = 512;
+
+//! Generate update code for one synapse, using either the spike or spike-like event update code
+void genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                      Substitutions &synSubs, const Backend &backend, bool trueSpike)
+{
+    if(trueSpike) {
+        sg.generateSpikeUpdate(backend, os, modelMerged, synSubs);
+    }
+    else {
+        sg.generateSpikeEventUpdate(backend, os, modelMerged, synSubs);
+    }
+}
+//----------------------------------------------------------------------------
+//! Add substitutions for functions used to accumulate input into postsynaptic neuron postIdx and presynaptic neuron $(id_pre)
+void addAccumulateSubstitutions(Substitutions &synSubs, const PresynapticUpdateGroupMerged &sg, const Backend &backend,
+                                unsigned int batchSize, const std::string &postIdx)
+{
+    if(sg.getArchetype().isDendriticDelayRequired()) {
+        synSubs.addFuncSubstitution("addToInSynDelay", 2, backend.getAccumulateTemplate("group->denDelay[" + sg.getPostDenDelayIndex(batchSize, postIdx, "$(1)") + "]"));
+    }
+    else {
+        synSubs.addFuncSubstitution("addToInSyn", 1, backend.getAccumulateTemplate("group->inSyn[" + sg.getPostISynIndex(batchSize, postIdx) + "]"));
+    }
+
+    if(sg.getArchetype().isPresynapticOutputRequired()) {
+        synSubs.addFuncSubstitution("addToPre", 1, backend.getAccumulateTemplate("group->revInSyn[" + sg.getPreISynIndex(batchSize, synSubs["id_pre"]) + "]"));
+    }
+}
+//----------------------------------------------------------------------------
+//! Generate loop through spiking presynaptic neurons, calling handler with $(id_pre) substituted for each one which passes any threshold re-test
+void genSpikeLoop(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                  const Substitutions &popSubs, const Backend &backend, bool trueSpike, bool parallel, BackendBase::Handler handler)
+{
+    const std::string eventSuffix = trueSpike ? "" : "Evnt";
+    const auto *wu = sg.getArchetype().getWUModel();
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
+
+    // Detect spike events or spikes and do the update
+    os << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
+    if(parallel) {
+        backend.genParallelForPreamble(os);
+    }
+    os << "for (unsigned int i = 0; i < group->srcSpkCnt" << eventSuffix << "[" << sg.getPreSlot(batchSize) << "]; i++)";
+    {
+        CodeStream::Scope b(os);
+        if(!wu->getSimSupportCode().empty()) {
+            os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) << ";" << std::endl;
+        }
+
+        os << "const unsigned int ipre = group->srcSpk" << eventSuffix << "[" << sg.getPreVarIndex(batchSize, VarAccessDuplication::DUPLICATE, "i") << "];" << std::endl;
+
+        Substitutions rowSubs(&popSubs);
+        rowSubs.addVarSubstitution("id_pre", "ipre");
+
+        // If this is a spike-like event, insert threshold check for this presynaptic neuron
+        if(!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+            os << "if(";
+
+            // Generate weight update threshold condition
+            Substitutions threshSubs(&rowSubs);
+            sg.generateSpikeEventThreshold(backend, os, modelMerged, threshSubs);
+
+            os << ")";
+            os << CodeStream::OB(10);
+        }
+
+        handler(os, rowSubs);
+
+        // If this is a spike-like event, close braces around threshold check
+        if(!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+            os << CodeStream::CB(10);
+        }
+    }
+}
+//----------------------------------------------------------------------------
+//! Does code consist solely of a single call to $(addToInSyn, ...) whose argument has no side effects?
+bool isPureAddToInSyn(const std::string &code)
+{
+    // Strip whitespace
+    std::string strippedCode;
+    std::remove_copy_if(code.cbegin(), code.cend(), std::back_inserter(strippedCode),
+                        [](char c){ return std::isspace(static_cast<unsigned char>(c)); });
+
+    // Check code is a single call to addToInSyn
+    const std::string prefix = "$(addToInSyn,";
+    const std::string suffix = ");";
+    if(strippedCode.size() <= (prefix.size() + suffix.size()) || strippedCode.compare(0, prefix.size(), prefix) != 0
+       || strippedCode.compare(strippedCode.size() - suffix.size(), suffix.size(), suffix) != 0)
+    {
+        return false;
+    }
+
+    // Check argument doesn't contain further statements, assignments, comments, calls to other accumulation functions or RNG use
+    const std::string argument = strippedCode.substr(prefix.size(), strippedCode.size() - prefix.size() - suffix.size());
+    return ((argument.find_first_of(";={}") == std::string::npos) && (argument.find("++") == std::string::npos)
+            && (argument.find("--") == std::string::npos) && (argument.find("//") == std::string::npos)
+            && (argument.find("/*") == std::string::npos) && (argument.find("$(addTo") == std::string::npos)
+            && !Utils::isRNGRequired(argument));
+}
+}   // Anonymous namespace
+
+//----------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::RowScatter
+//----------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace SingleThreadedCPU
+{
+namespace PresynapticUpdateStrategy
+{
+bool RowScatter::isCompatible(const SynapseGroupInternal &sg, const Preferences&, bool) const
+{
+    return ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (sg.getMatrixType() & SynapseMatrixConnectivity::DENSE)
+            || (sg.getMatrixType() & SynapseMatrixConnectivity::BITMASK));
+}
+//----------------------------------------------------------------------------
+void RowScatter::genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                           const Substitutions &popSubs, const Backend &backend, bool trueSpike) const
+{
+    const auto *wu = sg.getArchetype().getWUModel();
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
+    const bool parallel = Backend::canProcessRowsInParallel(sg.getArchetype(), trueSpike ? wu->getSimCode() : wu->getEventCode());
+    genSpikeLoop(os, modelMerged, sg, popSubs, backend, trueSpike, parallel,
+        [batchSize, trueSpike, &backend, &modelMerged, &sg](CodeStream &os, Substitutions &rowSubs)
+        {
+            Substitutions synSubs(&rowSubs);
+            synSubs.addVarSubstitution("id_post", "ipost");
+            synSubs.addVarSubstitution("id_syn", "synAddress");
+            addAccumulateSubstitutions(synSubs, sg, backend, batchSize, "ipost");
+
+            if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                os << "const unsigned int npost = group->rowLength[ipre];" << std::endl;
+                os << "for (unsigned int j = 0; j < npost; j++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "const unsigned int synAddress = (ipre * group->rowStride) + j;" << std::endl;
+                    os << "const unsigned int ipost = group->ind[synAddress];" << std::endl;
+
+                    genSynapseUpdate(os, modelMerged, sg, synSubs, backend, trueSpike);
+                }
+            }
+            // Otherwise (DENSE or BITMASK)
+            else {
+                os << "for (unsigned int ipost = 0; ipost < group->numTrgNeurons; ipost++)";
+                {
+                    CodeStream::Scope b(os);
+
+                    if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+                        os << "const uint64_t gid = (ipre * (uint64_t)group->numTrgNeurons + ipost);" << std::endl;
+                        os << "if (B(group->gp[gid / 32], gid & 31))" << CodeStream::OB(20);
+                    }
+
+                    os << "const unsigned int synAddress = (ipre * group->numTrgNeurons) + ipost;" << std::endl;
+
+                    genSynapseUpdate(os, modelMerged, sg, synSubs, backend, trueSpike);
+
+                    if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+                        os << CodeStream::CB(20);
+                    }
+                }
+            }
+        });
+}
+
+//----------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::RowScatterBitmask
+//----------------------------------------------------------------------------
+bool RowScatterBitmask::isCompatible(const SynapseGroupInternal &sg, const Preferences &preferences, bool) const
+{
+    return (preferences.enableBitmaskOptimisations && (sg.getMatrixType() & SynapseMatrixConnectivity::BITMASK));
+}
+//----------------------------------------------------------------------------
+void RowScatterBitmask::genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                                  const Substitutions &popSubs, const Backend &backend, bool trueSpike) const
+{
+    const auto *wu = sg.getArchetype().getWUModel();
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
+    const bool parallel = Backend::canProcessRowsInParallel(sg.getArchetype(), trueSpike ? wu->getSimCode() : wu->getEventCode());
+    genSpikeLoop(os, modelMerged, sg, popSubs, backend, trueSpike, parallel,
+        [batchSize, trueSpike, &backend, &modelMerged, &sg](CodeStream &os, Substitutions &rowSubs)
+        {
+            Substitutions synSubs(&rowSubs);
+            synSubs.addVarSubstitution("id_post", "ipost");
+            synSubs.addVarSubstitution("id_syn", "synAddress");
+            addAccumulateSubstitutions(synSubs, sg, backend, batchSize, "ipost");
+
+            // Determine the number of words in each row
+            os << "const unsigned int rowWords = ((group->numTrgNeurons + 32 - 1) / 32);" << std::endl;
+            os << "for(unsigned int w = 0; w < rowWords; w++)";
+            {
+                CodeStream::Scope b(os);
+
+                // Read row word
+                os << "uint32_t connectivityWord = group->gp[(ipre * rowWords) + w];" << std::endl;
+
+                // Set ipost to first synapse in connectivity word
+                os << "unsigned int ipost = w * 32;" << std::endl;
+
+                // While there any bits left
+                os << "while(connectivityWord != 0)";
+                {
+                    CodeStream::Scope b(os);
+
+                    // Cound leading zeros (as bits are indexed backwards this is index of next synapse)
+                    os << "const int numLZ = gennCLZ(connectivityWord);" << std::endl;
+
+                    // Shift off zeros and the one just discovered
+                    // **NOTE** << 32 appears to result in undefined behaviour
+                    os << "connectivityWord = (numLZ == 31) ? 0 : (connectivityWord << (numLZ + 1));" << std::endl;
+
+                    // Add to ipost
+                    os << "ipost += numLZ;" << std::endl;
+
+                    // If we aren't in padding region
+                    // **TODO** don't bother checking if there is no padding
+                    os << "if(ipost < group->numTrgNeurons)";
+                    {
+                        CodeStream::Scope b(os);
+                        genSynapseUpdate(os, modelMerged, sg, synSubs, backend, trueSpike);
+                    }
+
+                    // Increment ipost to take into account fact the next CLZ will go from bit AFTER synapse
+                    os << "ipost++;" << std::endl;
+                }
+            }
+        });
+}
+
+//----------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::RowScatterProcedural
+//----------------------------------------------------------------------------
+bool RowScatterProcedural::isCompatible(const SynapseGroupInternal &sg, const Preferences&, bool) const
+{
+    return (sg.getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL);
+}
+//----------------------------------------------------------------------------
+void RowScatterProcedural::genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                                     const Substitutions &popSubs, const Backend &backend, bool trueSpike) const
+{
+    const auto *wu = sg.getArchetype().getWUModel();
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
+    const bool parallel = Backend::canProcessRowsInParallel(sg.getArchetype(), trueSpike ? wu->getSimCode() : wu->getEventCode());
+    genSpikeLoop(os, modelMerged, sg, popSubs, backend, trueSpike, parallel,
+        [batchSize, trueSpike, &backend, &modelMerged, &sg](CodeStream &os, Substitutions &rowSubs)
+        {
+            // If an RNG is required to regenerate row, use counter-based RNG stream unique to this row of this group
+            // **NOTE** the same stream is used every time the row is regenerated so connectivity doesn't change
+            Substitutions rngSubs(&rowSubs);
+            if(isRNGRequired(sg.getArchetype())) {
+                backend.genCounterBasedRNGStream(os, rngSubs, modelMerged.getModel().getPrecision(), "procedural", "proceduralRNGKey",
+                                                 "ipre", "g", std::to_string(sg.getIndex()));
+            }
+
+            // Create substitution stack for generating procedural connectivity code
+            Substitutions connSubs(&rngSubs);
+            connSubs.addVarSubstitution("num_threads", "1");
+            connSubs.addVarSubstitution("id_post_begin", "0");
+            connSubs.addVarSubstitution("id_thread", "0");
+            connSubs.addVarSubstitution("num_post", "group->numTrgNeurons");
+            connSubs.addVarSubstitution("num_pre", "group->numSrcNeurons");
+
+            // Create another substitution stack for generating presynaptic simulation code
+            Substitutions presynapticUpdateSubs(&rngSubs);
+
+            // Replace $(id_post) with first 'function' parameter as simulation code is
+            // going to be, in turn, substituted into procedural connectivity generation code
+            presynapticUpdateSubs.addVarSubstitution("id_post", "$(0)");
+
+            // Replace kernel indices with the subsequent 'function' parameters
+            for(size_t i = 0; i < sg.getArchetype().getKernelSize().size(); i++) {
+                presynapticUpdateSubs.addVarSubstitution("id_kernel_" + std::to_string(i),
+                                                         "$(" + std::to_string(i + 1) + ")");
+            }
+            addAccumulateSubstitutions(presynapticUpdateSubs, sg, backend, batchSize, "$(id_post)");
+
+            // Generate presynaptic simulation code into new stringstream-backed code stream
+            std::ostringstream presynapticUpdateStream;
+            CodeStream presynapticUpdate(presynapticUpdateStream);
+            genSynapseUpdate(presynapticUpdate, modelMerged, sg, presynapticUpdateSubs, backend, trueSpike);
+
+            // When a synapse should be 'added', substitute in presynaptic update code
+            connSubs.addFuncSubstitution("addSynapse", 1 + (unsigned int)sg.getArchetype().getKernelSize().size(), presynapticUpdateStream.str());
+
+            // Regenerate row, applying presynaptic update to each synapse
+            sg.generateProceduralConnectivity(backend, os, modelMerged, connSubs);
+        });
+}
+//----------------------------------------------------------------------------
+bool RowScatterProcedural::isRNGRequired(const SynapseGroupInternal &sg)
+{
+    return ((sg.getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL)
+            && (Utils::isRNGRequired(sg.getConnectivityInitialiser().getSnippet()->getRowBuildCode())
+                || ((sg.getMatrixType() & SynapseMatrixWeight::PROCEDURAL) && Utils::isRNGRequired(sg.getWUVarInitialisers()))));
+}
+
+//----------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::RowScatterVectorised
+//----------------------------------------------------------------------------
+bool RowScatterVectorised::isCompatible(const SynapseGroupInternal &sg, const Preferences &preferences, bool trueSpike) const
+{
+    return ((preferences.sparseRowStrideAlignment > 1) && trueSpike && (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE)
+            && !sg.isDeltaEncodedSparseIndEnabled() && !sg.isDendriticDelayRequired() && !sg.isPresynapticOutputRequired()
+            && isPureAddToInSyn(sg.getWUModel()->getSimCode()));
+}
+//----------------------------------------------------------------------------
+void RowScatterVectorised::genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                                     const Substitutions &popSubs, const Backend &backend, bool) const
+{
+    const auto *wu = sg.getArchetype().getWUModel();
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
+    const unsigned int chunkSize = backend.getPreferences<Preferences>().sparseRowStrideAlignment;
+    const bool parallel = Backend::canProcessRowsInParallel(sg.getArchetype(), wu->getSimCode());
+    genSpikeLoop(os, modelMerged, sg, popSubs, backend, true, parallel,
+        [batchSize, chunkSize, &backend, &modelMerged, &sg](CodeStream &os, Substitutions &rowSubs)
+        {
+            os << "const unsigned int npost = group->rowLength[ipre];" << std::endl;
+            os << "const unsigned int rowStart = ipre * group->rowStride;" << std::endl;
+            os << "for(unsigned int c = 0; c < npost; c += " << chunkSize << ")";
+            {
+                CodeStream::Scope b(os);
+                os << modelMerged.getModel().getPrecision() << " lInput[" << chunkSize << "];" << std::endl;
+
+                // Calculate input from chunk of synapses, masking the indices of any synapses beyond the end of the row
+                // **NOTE** row stride is padded to a multiple of the chunk size so this never reads beyond the end of the row
+                os << "for(unsigned int k = 0; k < " << chunkSize << "; k++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "const unsigned int synAddress = rowStart + c + k;" << std::endl;
+                    os << "const unsigned int ipost = ((c + k) < npost) ? group->ind[synAddress] : 0;" << std::endl;
+
+                    Substitutions synSubs(&rowSubs);
+                    synSubs.addVarSubstitution("id_post", "ipost");
+                    synSubs.addVarSubstitution("id_syn", "synAddress");
+                    synSubs.addFuncSubstitution("addToInSyn", 1, "lInput[k] = $(0)");
+                    sg.generateSpikeUpdate(backend, os, modelMerged, synSubs);
+                }
+
+                // Scatter input from synapses within row to postsynaptic neurons
+                os << "const unsigned int chunkLength = ((npost - c) < " << chunkSize << ") ? (npost - c) : " << chunkSize << ";" << std::endl;
+                os << "for(unsigned int k = 0; k < chunkLength; k++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "const unsigned int ipost = group->ind[rowStart + c + k];" << std::endl;
+
+                    Substitutions scatterSubs(&rowSubs);
+                    scatterSubs.addFuncSubstitution("addToInSyn", 1, backend.getAccumulateTemplate("group->inSyn[" + sg.getPostISynIndex(batchSize, "ipost") + "]"));
+
+                    std::string code = "$(addToInSyn, lInput[k]);";
+                    scatterSubs.applyCheckUnreplaced(code, "presynapticUpdate : merged" + std::to_string(sg.getIndex()));
+                    os << code << std::endl;
+                }
+            }
+        });
+}
+
+//----------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::RowScatterDeltaEncoded
+//----------------------------------------------------------------------------
+bool RowScatterDeltaEncoded::isCompatible(const SynapseGroupInternal &sg, const Preferences&, bool) const
+{
+    return ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) && sg.isDeltaEncodedSparseIndEnabled());
+}
+//----------------------------------------------------------------------------
+void RowScatterDeltaEncoded::genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                                       const Substitutions &popSubs, const Backend &backend, bool trueSpike) const
+{
+    const auto *wu = sg.getArchetype().getWUModel();
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
+    const bool parallel = Backend::canProcessRowsInParallel(sg.getArchetype(), trueSpike ? wu->getSimCode() : wu->getEventCode());
+    genSpikeLoop(os, modelMerged, sg, popSubs, backend, trueSpike, parallel,
+        [batchSize, trueSpike, &backend, &modelMerged, &sg](CodeStream &os, Substitutions &rowSubs)
+        {
+            Substitutions synSubs(&rowSubs);
+            synSubs.addVarSubstitution("id_post", "ipost");
+            synSubs.addVarSubstitution("id_syn", "synAddress");
+            addAccumulateSubstitutions(synSubs, sg, backend, batchSize, "ipost");
+
+            // Decode postsynaptic index of each synapse by adding the next delta to that of the previous synapse in the row
+            os << "const unsigned int npost = group->rowLength[ipre];" << std::endl;
+            os << "const uint8_t *indDeltaPtr = &group->indDelta[(size_t)ipre * group->indDeltaStride];" << std::endl;
+            os << "unsigned int ipost = 0;" << std::endl;
+            os << "for (unsigned int j = 0; j < npost; j++)";
+            {
+                CodeStream::Scope b(os);
+                os << "const unsigned int synAddress = (ipre * group->rowStride) + j;" << std::endl;
+                os << "ipost += gennDecodeIndDelta(indDeltaPtr);" << std::endl;
+
+                genSynapseUpdate(os, modelMerged, sg, synSubs, backend, trueSpike);
+            }
+        });
+}
+
+//----------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::Toeplitz
+//----------------------------------------------------------------------------
+bool Toeplitz::isCompatible(const SynapseGroupInternal &sg, const Preferences&, bool) const
+{
+    return (sg.getMatrixType() & SynapseMatrixConnectivity::TOEPLITZ);
+}
+//----------------------------------------------------------------------------
+void Toeplitz::genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                         const Substitutions &popSubs, const Backend &backend, bool trueSpike) const
+{
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
+    const auto &connectInit = sg.getArchetype().getToeplitzConnectivityInitialiser();
+
+    // Loop through Toeplitz matrix diagonals
+    os << "for(unsigned int j = 0; j < group->rowStride; j++)";
+    {
+        CodeStream::Scope b(os);
+
+        // Create substitution stack for generating procedural connectivity code
+        Substitutions connSubs(&popSubs);
+        connSubs.addVarSubstitution("id_diag", "j");
+
+        // Add substitutions
+        connSubs.addParamValueSubstitution(connectInit.getSnippet()->getParamNames(), connectInit.getParams(),
+                                           [&sg](size_t i) { return sg.isToeplitzConnectivityInitParamHeterogeneous(i);  },
+                                           "", "group->");
+        connSubs.addVarValueSubstitution(connectInit.getSnippet()->getDerivedParams(), connectInit.getDerivedParams(),
+                                         [&sg](size_t i) { return sg.isToeplitzConnectivityInitDerivedParamHeterogeneous(i);  },
+                                         "", "group->");
+        connSubs.addVarNameSubstitution(connectInit.getSnippet()->getExtraGlobalParams(), "", "group->");
+        connSubs.addVarNameSubstitution(connectInit.getSnippet()->getDiagonalBuildStateVars());
+
+        // Initialise any diagonal build state variables defined
+        for (const auto &d : connectInit.getSnippet()->getDiagonalBuildStateVars()) {
+            // Apply substitutions to value
+            std::string value = d.value;
+            connSubs.applyCheckUnreplaced(value, "toeplitz diagonal build state var : merged" + std::to_string(sg.getIndex()));
+            value = ensureFtype(value, modelMerged.getModel().getPrecision());
+
+            os << d.type << " " << d.name << " = " << value << ";" << std::endl;
+        }
+
+        // Loop through spikes
+        genSpikeLoop(os, modelMerged, sg, popSubs, backend, trueSpike, false,
+            [batchSize, trueSpike, &backend, &connSubs, &modelMerged, &sg](CodeStream &os, Substitutions &rowSubs)
+            {
+                connSubs.addVarSubstitution("id_pre", "ipre");
+
+                // Create another substitution stack for generating presynaptic simulation code
+                Substitutions presynapticUpdateSubs(&rowSubs);
+
+                // Replace $(id_post) with first 'function' parameter as simulation code is
+                // going to be, in turn, substituted into procedural connectivity generation code
+                presynapticUpdateSubs.addVarSubstitution("id_post", "$(0)");
+
+                // Replace kernel indices with the subsequent 'function' parameters
+                for(size_t i = 0; i < sg.getArchetype().getKernelSize().size(); i++) {
+                    presynapticUpdateSubs.addVarSubstitution("id_kernel_" + std::to_string(i),
+                                                             "$(" + std::to_string(i + 1) + ")");
+                }
+                addAccumulateSubstitutions(presynapticUpdateSubs, sg, backend, batchSize, "$(id_post)");
+
+                // Generate presynaptic simulation code into new stringstream-backed code stream
+                std::ostringstream presynapticUpdateStream;
+                CodeStream presynapticUpdate(presynapticUpdateStream);
+                genSynapseUpdate(presynapticUpdate, modelMerged, sg, presynapticUpdateSubs, backend, trueSpike);
+
+                // When a synapse should be 'added', substitute in presynaptic update code
+                connSubs.addFuncSubstitution("addSynapse", 1 + (unsigned int)sg.getArchetype().getKernelSize().size(), presynapticUpdateStream.str());
+
+                // Generate toeplitz connectivity code
+                sg.generateToeplitzConnectivity(backend, os, modelMerged, connSubs);
+            });
+    }
+}
+
+//----------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::TiledDense
+//----------------------------------------------------------------------------
+bool TiledDense::isCompatible(const SynapseGroupInternal &sg, const Preferences&, bool trueSpike) const
+{
+    if(!sg.isTiledDenseUpdateEnabled() || !trueSpike) {
+        return false;
+    }
+    else if(sg.isDendriticDelayRequired() || sg.isPresynapticOutputRequired() || !isPureAddToInSyn(sg.getWUModel()->getSimCode())) {
+        LOGW_BACKEND << "Tiled dense update enabled for synapse group '" << sg.getName() << "' but it can only be used if weight update model simulation code consists solely of a call to $(addToInSyn, ...)";
+        return false;
+    }
+    else {
+        return true;
+    }
+}
+//----------------------------------------------------------------------------
+void TiledDense::genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                           const Substitutions &popSubs, const Backend &backend, bool) const
+{
+    const auto *wu = sg.getArchetype().getWUModel();
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
+
+    // Loop through tiles of postsynaptic neurons
+    // **NOTE** each tile updates a distinct range of postsynaptic neurons so tiles can always be processed in parallel
+    os << "// process presynaptic events: True Spikes (tiled)" << std::endl;
+    os << "const unsigned int numSpikes = group->srcSpkCnt[" << sg.getPreSlot(batchSize) << "];" << std::endl;
+    backend.genParallelForPreamble(os);
+    os << "for(unsigned int tileStart = 0; tileStart < group->numTrgNeurons; tileStart += " << denseTileSize << ")";
+    {
+        CodeStream::Scope b(os);
+        if(!wu->getSimSupportCode().empty()) {
+            os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) << ";" << std::endl;
+        }
+        os << "const unsigned int tileEnd = ((group->numTrgNeurons - tileStart) < " << denseTileSize << ") ? group->numTrgNeurons : (tileStart + " << denseTileSize << ");" << std::endl;
+
+        // Zero local input for this tile
+        os << modelMerged.getModel().getPrecision() << " lInSyn[" << denseTileSize << "] = {};" << std::endl;
+
+        // Loop through spikes, accumulating the input they provide to the tile
+        os << "for(unsigned int i = 0; i < numSpikes; i++)";
+        {
+            CodeStream::Scope b(os);
+            os << "const unsigned int ipre = group->srcSpk[" << sg.getPreVarIndex(batchSize, VarAccessDuplication::DUPLICATE, "i") << "];" << std::endl;
+            os << "for(unsigned int ipost = tileStart; ipost < tileEnd; ipost++)";
+            {
+                CodeStream::Scope b(os);
+                os << "const unsigned int synAddress = (ipre * group->numTrgNeurons) + ipost;" << std::endl;
+
+                Substitutions synSubs(&popSubs);
+                synSubs.addVarSubstitution("id_pre", "ipre");
+                synSubs.addVarSubstitution("id_post", "ipost");
+                synSubs.addVarSubstitution("id_syn", "synAddress");
+                synSubs.addFuncSubstitution("addToInSyn", 1, "lInSyn[ipost - tileStart] += $(0)");
+                sg.generateSpikeUpdate(backend, os, modelMerged, synSubs);
+            }
+        }
+
+        // Add tile's input to postsynaptic neurons
+        os << "for(unsigned int ipost = tileStart; ipost < tileEnd; ipost++)";
+        {
+            CodeStream::Scope b(os);
+            os << "group->inSyn[" << sg.getPostISynIndex(batchSize, "ipost") << "] += lInSyn[ipost - tileStart];" << std::endl;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::ColumnGather
+//----------------------------------------------------------------------------
+bool ColumnGather::isCompatible(const SynapseGroupInternal &sg, const Preferences&, bool) const
+{
+    return (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) && sg.isPostsynapticGatherEnabled();
+}
+//----------------------------------------------------------------------------
+void ColumnGather::genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                             const Substitutions &popSubs, const Backend &backend, bool trueSpike) const
+{
+    const auto *wu = sg.getArchetype().getWUModel();
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
+
+    // Zero bitmask of presynaptic neurons which have spiked
+    os << "std::fill_n(group->preSpikeBits, (group->numSrcNeurons + 31) / 32, 0);" << std::endl;
+
+    // Loop through spikes, setting bits of presynaptic neurons which have spiked (and pass any threshold re-test)
+    genSpikeLoop(os, modelMerged, sg, popSubs, backend, trueSpike, false,
+                 [](CodeStream &os, Substitutions&)
+                 {
+                     os << "setB(group->preSpikeBits[ipre / 32], ipre & 31);" << std::endl;
+                 });
+
+    // If all groups have the same row stride, divide by a literal so the compiler can replace the division with a
+    // multiplication; otherwise, calculate multiplier for fast division by this group's row stride at runtime
+    const bool rowStrideHomogeneous = backend.isRowStrideHomogeneous(sg);
+    if(!rowStrideHomogeneous) {
+        os << "const uint64_t rowStrideMagic = gennFastDivideMagic(group->rowStride);" << std::endl;
+    }
+
+    // Loop through postsynaptic neurons
+    // **NOTE** only one iteration updates each postsynaptic neuron's input so columns can be processed
+    // in parallel unless the code writes variables associated with presynaptic neurons
+    if(Backend::canProcessColumnsInParallel(sg.getArchetype(), trueSpike ? wu->getSimCode() : wu->getEventCode())) {
+        backend.genParallelForPreamble(os);
+    }
+    os << "for(unsigned int ipost = 0; ipost < group->numTrgNeurons; ipost++)";
+    {
+        CodeStream::Scope b(os);
+        if(!wu->getSimSupportCode().empty()) {
+            os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) << ";" << std::endl;
+        }
+
+        // If input isn't dendritically delayed, accumulate it in a register
+        const bool dendriticDelay = sg.getArchetype().isDendriticDelayRequired();
+        if(!dendriticDelay) {
+            os << modelMerged.getModel().getPrecision() << " lInSyn = 0;" << std::endl;
+        }
+
+        // Loop through column of presynaptic neurons
+        os << "const unsigned int npre = group->colLength[ipost];" << std::endl;
+        os << "for(unsigned int j = 0; j < npre; j++)";
+        {
+            CodeStream::Scope b(os);
+
+            // Use remapping to find index of synapse in row-major matrix and, from this, the presynaptic index
+            os << "const unsigned int synAddress = group->remap[(ipost * group->colStride) + j];" << std::endl;
+            if(rowStrideHomogeneous) {
+                os << "const unsigned int ipre = synAddress / " << backend.getSynapticMatrixRowStride(sg.getArchetype()) << ";" << std::endl;
+            }
+            else {
+                os << "const unsigned int ipre = gennFastDivide(synAddress, rowStrideMagic, group->rowStride);" << std::endl;
+            }
+
+            // If presynaptic neuron has spiked
+            os << "if(B(group->preSpikeBits[ipre / 32], ipre & 31))";
+            {
+                CodeStream::Scope b(os);
+
+                Substitutions synSubs(&popSubs);
+                synSubs.addVarSubstitution("id_pre", "ipre");
+                synSubs.addVarSubstitution("id_post", "ipost");
+                synSubs.addVarSubstitution("id_syn", "synAddress");
+
+                // Only this iteration updates this postsynaptic neuron's input so it can be accumulated without synchronisation
+                if(dendriticDelay) {
+                    synSubs.addFuncSubstitution("addToInSynDelay", 2, "group->denDelay[" + sg.getPostDenDelayIndex(batchSize, "ipost", "$(1)") + "] += $(0)");
+                }
+                else {
+                    synSubs.addFuncSubstitution("addToInSyn", 1, "lInSyn += $(0)");
+                }
+
+                if(sg.getArchetype().isPresynapticOutputRequired()) {
+                    synSubs.addFuncSubstitution("addToPre", 1, backend.getAccumulateTemplate("group->revInSyn[" + sg.getPreISynIndex(batchSize, "ipre") + "]"));
+                }
+
+                genSynapseUpdate(os, modelMerged, sg, synSubs, backend, trueSpike);
+            }
+        }
+
+        // Add accumulated input to postsynaptic neuron
+        if(!dendriticDelay) {
+            os << "group->inSyn[" << sg.getPostISynIndex(batchSize, "ipost") << "] += lInSyn;" << std::endl;
+        }
+    }
+}
+}   // namespace PresynapticUpdateStrategy
+}   // namespace SingleThreadedCPU
+}   // namespace CodeGenerator
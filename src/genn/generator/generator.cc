@@ -114,7 +114,7 @@ int main(int argc,     //!< number of arguments; expected to be 3
 #else
         // Create makefile to compile and link all generated modules
         std::ofstream makefile((outputPath / "Makefile").str());
-        CodeGenerator::generateMakefile(makefile, backend, moduleNames);
+        CodeGenerator::generateMakefile(makefile, model, backend, moduleNames);
 #endif
 
     }
@@ -91,6 +91,12 @@ bool BackendBase::areSixtyFourBitSynapseIndicesRequired(const SynapseGroupMerged
     return ((maxSynapses & 0xFFFFFFFF00000000ULL) != 0);
 }
 //-----------------------------------------------------------------------
+bool BackendBase::isSynapseGroupPostsynapticRemapRequired(const SynapseGroupInternal &sg) const
+{
+    return ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) && isPostsynapticRemapRequired()
+            && (!sg.getWUModel()->getLearnPostCode().empty() || isPostsynapticGatherRequired(sg)));
+}
+//-----------------------------------------------------------------------
 void BackendBase::genNeuronIndexCalculation(CodeStream &os, const NeuronUpdateGroupMerged &ng, unsigned int batchSize) const
 {
     // If batching is enabled, calculate batch offset
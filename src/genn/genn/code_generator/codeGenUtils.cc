@@ -18,10 +18,16 @@
     #error "GeNN now requires a functioning std::regex implementation - please upgrade your version of GCC to at least 4.9.1"
 #endif
 
+// Standard C++ includes
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
 // Standard C includes
 #include <cstring>
 
 // GeNN includes
+#include "logging.h"
 #include "modelSpec.h"
 
 // GeNN code generator includes
@@ -111,11 +117,19 @@ const char *mathsFuncs[][MathsFuncMax] = {
 //--------------------------------------------------------------------------
 void ensureMathFunctionFtype(std::string &code)
 {
+    // Build map of explicit single-precision maths functions to C++ versions where overloads should work the same
+    static const std::unordered_map<std::string, std::string> singleToCPPMathsFuncs = 
+        []()
+        {
+            std::unordered_map<std::string, std::string> funcs;
+            for(const auto &m : mathsFuncs) {
+                funcs.emplace(m[MathsFuncSingle], m[MathsFuncCPP]);
+            }
+            return funcs;
+        }();
+
     // Replace any outstanding explicit single-precision maths functions  
-    // with C++ versions where overloads should work the same
-    for(const auto &m : mathsFuncs) {
-        CodeGenerator::regexFuncSubstitute(code, m[MathsFuncSingle], m[MathsFuncCPP]);
-    }
+    CodeGenerator::funcSubstitute(code, singleToCPPMathsFuncs);
 }
 
 //--------------------------------------------------------------------------
@@ -144,45 +158,66 @@ void doFinal(std::string &code, unsigned int i, const std::string &type, unsigne
     }
 }
 
-bool regexSubstitute(std::string &s, const std::regex &regex, const std::string &format)
+//--------------------------------------------------------------------------
+//! Can character be part of an identifier (or number)?
+//--------------------------------------------------------------------------
+bool isIdentifierChar(char c)
+{
+    return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_');
+}
+
+//--------------------------------------------------------------------------
+//! Is identifier ending at index end followed by (optional whitespace and) an opening bracket?
+//--------------------------------------------------------------------------
+bool isFunctionCall(const std::string &s, size_t end)
+{
+    while(end < s.size() && ::isspace(s[end])) {
+        end++;
+    }
+    return (end < s.size() && s[end] == '(');
+}
+
+//--------------------------------------------------------------------------
+/*! \brief Tokenise s into runs of identifier characters in a single pass, calling getReplacementFn with the
+           start and end index of each one and replacing it with the string returned, unless this is nullptr
+ */
+//--------------------------------------------------------------------------
+template<typename F>
+bool substituteIdentifiers(std::string &s, F getReplacementFn)
 {
-    // **NOTE** the following code performs the same function as std::regex_replace
-    // but has a return value indicating whether any replacements are made
-    // see http://en.cppreference.com/w/cpp/regex/regex_replace
+    std::string output;
+    size_t copiedEnd = 0;
+    for(size_t i = 0; i < s.size();) {
+        // Skip characters which aren't part of identifiers
+        if(!isIdentifierChar(s[i])) {
+            i++;
+            continue;
+        }
 
-    // Create regex iterator to iterate over matches found in code
-    std::sregex_iterator matchesBegin(s.cbegin(), s.cend(), regex);
-    std::sregex_iterator matchesEnd;
+        // Find end of identifier
+        size_t end = i + 1;
+        while(end < s.size() && isIdentifierChar(s[end])) {
+            end++;
+        }
 
-    // If there are no matches, leave s unmodified and return false
-    if(matchesBegin == matchesEnd) {
+        // If identifier should be replaced, copy preceding code and replacement into output
+        const std::string *replacement = getReplacementFn(i, end);
+        if(replacement) {
+            output.append(s, copiedEnd, i - copiedEnd);
+            output.append(*replacement);
+            copiedEnd = end;
+        }
+        i = end;
+    }
+
+    // If no replacements were made, leave s unmodified and return false
+    if(copiedEnd == 0) {
         return false;
     }
-    // Otherwise
+    // Otherwise, copy remaining code into output, replace s with it and return true
     else {
-        // Loop through matches
-        std::string output;
-        for(std::sregex_iterator m = matchesBegin;;) {
-            // Copy the non-matched subsequence (m->prefix()) onto output
-            std::copy(m->prefix().first, m->prefix().second, std::back_inserter(output));
-
-            // Then replaces the matched subsequence with the formatted replacement string
-            m->format(std::back_inserter(output), format);
-
-            // If there are no subsequent matches
-            if(std::next(m) == matchesEnd) {
-                // Copy the remaining non-matched characters onto output
-                std::copy(m->suffix().first, m->suffix().second, std::back_inserter(output));
-                break;
-            }
-            // Otherwise go onto next match
-            else {
-                m++;
-            }
-        }
-
-        // Set reference to newly processed version and return true
-        s = output;
+        output.append(s, copiedEnd, std::string::npos);
+        s.swap(output);
         return true;
     }
 }
@@ -206,37 +241,60 @@ void substitute(std::string &s, const std::string &trg, const std::string &rep)
 }
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting variable  names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting variable names in the neuron code strings or other templates
 //--------------------------------------------------------------------------
-bool regexVarSubstitute(std::string &s, const std::string &trg, const std::string &rep)
+bool varSubstitute(std::string &s, const std::string &trg, const std::string &rep)
 {
-    // Build a regex to match variable name with at least one
-    // character that can't be in a variable name on either side (or an end/beginning of string)
-    // **NOTE** the suffix is non-capturing so two instances of variables separated by a single character are matched e.g. a*a
-    std::regex regex("(^|[^0-9a-zA-Z_])" + trg + "(?=$|[^a-zA-Z0-9_])");
-
-    // Create format string to replace in text
-    // **NOTE** preceding character is captured as C++ regex doesn't support lookbehind so this needs to be replaced in
-    const std::string format = "$1" + rep;
-
-    return regexSubstitute(s, regex, format);
+    return substituteIdentifiers(s,
+                                 [&s, &trg, &rep](size_t start, size_t end)
+                                 {
+                                     return ((end - start) == trg.size() && s.compare(start, end - start, trg) == 0) ? &rep : nullptr;
+                                 });
+}
+//--------------------------------------------------------------------------
+bool varSubstitute(std::string &s, const std::unordered_map<std::string, std::string> &substitutions)
+{
+    return substituteIdentifiers(s,
+                                 [&s, &substitutions](size_t start, size_t end)
+                                 {
+                                     const auto sub = substitutions.find(s.substr(start, end - start));
+                                     return (sub == substitutions.cend()) ? nullptr : &sub->second;
+                                 });
+}
+//--------------------------------------------------------------------------
+//! \brief Tool for substituting function names in the neuron code strings or other templates
+//--------------------------------------------------------------------------
+bool funcSubstitute(std::string &s, const std::string &trg, const std::string &rep)
+{
+    return substituteIdentifiers(s,
+                                 [&s, &trg, &rep](size_t start, size_t end)
+                                 {
+                                     return ((end - start) == trg.size() && s.compare(start, end - start, trg) == 0 
+                                             && isFunctionCall(s, end)) ? &rep : nullptr;
+                                 });
+}
+//--------------------------------------------------------------------------
+bool funcSubstitute(std::string &s, const std::unordered_map<std::string, std::string> &substitutions)
+{
+    return substituteIdentifiers(s,
+                                 [&s, &substitutions](size_t start, size_t end)
+                                 {
+                                     if(!isFunctionCall(s, end)) {
+                                         return static_cast<const std::string*>(nullptr);
+                                     }
+                                     const auto sub = substitutions.find(s.substr(start, end - start));
+                                     return (sub == substitutions.cend()) ? nullptr : &sub->second;
+                                 });
 }
-
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting function  names in the neuron code strings or other templates using regular expressions
+bool regexVarSubstitute(std::string &s, const std::string &trg, const std::string &rep)
+{
+    return varSubstitute(s, trg, rep);
+}
 //--------------------------------------------------------------------------
 bool regexFuncSubstitute(std::string &s, const std::string &trg, const std::string &rep)
 {
-    // Build a regex to match function name with at least one
-    // character that can't be part of the function name on the left and a bracket on the right (with optional whitespace)
-    // **NOTE** the suffix is non-capturing so two instances of functions separated by a single character are matched e.g. sin(cos(x));
-    std::regex regex("(^|[^0-9a-zA-Z_])" + trg + "(?=\\s*\\()");
-
-    // Create format string to replace in text
-    // **NOTE** preceding character is captured as C++ regex doesn't support lookbehind so this needs to be replaced in
-    const std::string format = "$1" + rep;
-
-    return regexSubstitute(s, regex, format);
+    return funcSubstitute(s, trg, rep);
 }
 
 //--------------------------------------------------------------------------
@@ -512,10 +570,20 @@ std::string getReductionOperation(const std::string &reduction, const std::strin
 
 void checkUnreplacedVariables(const std::string &code, const std::string &codeName)
 {
-    std::regex rgx("\\$\\([\\w]+\\)");
+    // Search for any remaining $(XXXX) where XXXX is a non-empty run of identifier characters
     std::string vars= "";
-    for (std::sregex_iterator it(code.begin(), code.end(), rgx), end; it != end; it++) {
-        vars+= it->str().substr(2,it->str().size()-3) + ", ";
+    for(size_t start = code.find("$("); start != std::string::npos;) {
+        size_t end = start + 2;
+        while(end < code.size() && isIdentifierChar(code[end])) {
+            end++;
+        }
+        if(end > (start + 2) && end < code.size() && code[end] == ')') {
+            vars+= code.substr(start + 2, end - start - 2) + ", ";
+            start = code.find("$(", end + 1);
+        }
+        else {
+            start = code.find("$(", start + 1);
+        }
     }
     if (vars.size() > 0) {
         vars= vars.substr(0, vars.size()-2);
@@ -554,4 +622,24 @@ std::string disambiguateNamespaceFunction(const std::string supportCode, const s
     }
     return newCode;
 }
+//--------------------------------------------------------------------------
+void writeFileIfChanged(const std::string &filename, const std::string &contents)
+{
+    // If file exists, read its current contents
+    std::ifstream inputStream(filename, std::ios::binary);
+    if(inputStream.good()) {
+        std::ostringstream currentContents;
+        currentContents << inputStream.rdbuf();
+
+        // If contents are unchanged, leave file untouched
+        if(currentContents.str() == contents) {
+            LOGD_CODE_GEN << "'" << filename << "' unchanged - not re-writing";
+            return;
+        }
+    }
+
+    // Write new contents to file
+    std::ofstream outputStream(filename, std::ios::binary);
+    outputStream << contents;
+}
 }   // namespace CodeGenerator
@@ -4,7 +4,7 @@
 #include <string>
 
 // GeNN includes
-#include "modelSpec.h"
+#include "modelSpecInternal.h"
 
 // GeNN code generator includes
 #include "code_generator/backendBase.h"
@@ -12,7 +12,7 @@
 //--------------------------------------------------------------------------
 // CodeGenerator
 //--------------------------------------------------------------------------
-void CodeGenerator::generateMakefile(std::ostream &os, const BackendBase &backend,
+void CodeGenerator::generateMakefile(std::ostream &os, const ModelSpecInternal &model, const BackendBase &backend,
                                      const std::vector<std::string> &moduleNames)
 {
     //**TODO** deal with standard include paths e.g. MPI here
@@ -26,6 +26,13 @@ void CodeGenerator::generateMakefile(std::ostream &os, const BackendBase &backen
 
     // Generate make file preamble
     backend.genMakefilePreamble(os);
+
+    // If recording data is copied asynchronously, add pthread flags to both compilation and linking
+    if(model.isRecordingInUse() && model.getNumAsyncRecordingBuffers() > 0) {
+        os << "CXXFLAGS += -pthread" << std::endl;
+        os << "LINKFLAGS += -pthread" << std::endl;
+        os << std::endl;
+    }
     os << std::endl;
 
     // Apply substitution to generate dependency list
@@ -1,8 +1,16 @@
 #include "code_generator/generateModules.h"
 
 // Standard C++ includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <fstream>
+#include <functional>
+#include <future>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 // PLOG includes
@@ -15,6 +23,7 @@
 #include "modelSpecInternal.h"
 
 // Code generator includes
+#include "code_generator/codeGenUtils.h"
 #include "code_generator/codeStream.h"
 #include "code_generator/generateSupportCode.h"
 #include "code_generator/generateRunner.h"
@@ -48,7 +57,8 @@ void copyFile(const filesystem::path &file, const filesystem::path &sharePath, c
     outputFileStream << inputFileStream.rdbuf();
 }
 //--------------------------------------------------------------------------
-bool shouldRebuildModel(const filesystem::path &outputPath, const boost::uuids::detail::sha1::digest_type &hashDigest, MemAlloc &mem)
+bool shouldRebuildModel(const filesystem::path &outputPath, const boost::uuids::detail::sha1::digest_type &hashDigest, MemAlloc &mem,
+                        std::unordered_map<std::string, boost::uuids::detail::sha1::digest_type> &previousModuleHashDigests)
 {
     try
     {
@@ -69,6 +79,21 @@ bool shouldRebuildModel(const filesystem::path &outputPath, const boost::uuids::
         is >> std::dec;
         is >> mem;
 
+        // Read names and hash digests of individual modules until end of file
+        // **NOTE** if these are missing e.g. because model was generated by an older version of GeNN, all modules will be regenerated
+        is.exceptions(std::ifstream::badbit);
+        is >> std::hex;
+        std::string moduleName;
+        while(is >> moduleName) {
+            boost::uuids::detail::sha1::digest_type moduleHashDigest;
+            for(auto &d : moduleHashDigest) {
+                is >> d;
+            }
+            if(is) {
+                previousModuleHashDigests.emplace(moduleName, moduleHashDigest);
+            }
+        }
+
         // If hash matches
         if(previousHashDigest == hashDigest) {
             LOGD_CODE_GEN << "Model unchanged - skipping code generation";
@@ -84,6 +109,71 @@ bool shouldRebuildModel(const filesystem::path &outputPath, const boost::uuids::
 
     return true;
 }
+//--------------------------------------------------------------------------
+void runGenerationTasks(const std::vector<std::pair<std::string, std::function<void()>>> &tasks)
+{
+    // Wrap each task in a packaged task which times it and captures any exception it throws
+    std::vector<std::packaged_task<void()>> packagedTasks;
+    std::vector<std::future<void>> futures;
+    packagedTasks.reserve(tasks.size());
+    futures.reserve(tasks.size());
+    for(const auto &t : tasks) {
+        packagedTasks.emplace_back(
+            [&t]()
+            {
+                const auto startTime = std::chrono::high_resolution_clock::now();
+                t.second();
+                const std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - startTime;
+                LOGI_CODE_GEN << "Generated '" << t.first << "' in " << duration.count() << " ms";
+            });
+        futures.push_back(packagedTasks.back().get_future());
+    }
+
+    // Launch (at most) one worker thread per hardware thread, each of which runs tasks until none remain
+    const size_t numThreads = std::min<size_t>(tasks.size(), std::max(1u, std::thread::hardware_concurrency()));
+    std::atomic<size_t> nextTask{0};
+    std::vector<std::thread> workers;
+    for(size_t i = 0; i < numThreads; i++) {
+        workers.emplace_back(
+            [&nextTask, &packagedTasks]()
+            {
+                for(size_t t = nextTask++; t < packagedTasks.size(); t = nextTask++) {
+                    packagedTasks[t]();
+                }
+            });
+    }
+
+    // Wait for all workers to complete
+    for(auto &w : workers) {
+        w.join();
+    }
+
+    // Rethrow any exceptions thrown by tasks on this thread
+    for(auto &f : futures) {
+        f.get();
+    }
+}
+
+//--------------------------------------------------------------------------
+// Module
+//--------------------------------------------------------------------------
+//! Module which can be re-generated independently of the rest of the model
+struct Module
+{
+    typedef boost::uuids::detail::sha1::digest_type (ModelSpecMerged::*GetHashDigestFn)(const BackendBase&) const;
+    typedef void (*GenerateFn)(const filesystem::path&, const ModelSpecMerged&, const BackendBase&, const std::string&);
+
+    std::string name;
+    GetHashDigestFn getHashDigest;
+    GenerateFn generate;
+};
+
+// **NOTE** the runner depends on every merged group so is always generated if model changes
+const std::vector<Module> modules = {
+    {"synapseUpdate",   &ModelSpecMerged::getSynapseUpdateModuleHashDigest, &generateSynapseUpdate},
+    {"neuronUpdate",    &ModelSpecMerged::getNeuronUpdateModuleHashDigest,  &generateNeuronUpdate},
+    {"customUpdate",    &ModelSpecMerged::getCustomUpdateModuleHashDigest,  &generateCustomUpdate},
+    {"init",            &ModelSpecMerged::getInitModuleHashDigest,          &generateInit}};
 
 }   // Anonymous namespace
 
@@ -103,19 +193,54 @@ std::pair<std::vector<std::string>, MemAlloc> CodeGenerator::generateAll(const M
     // If force rebuild flag is set or model should be rebuilt
     const auto hashDigest = modelMerged.getHashDigest(backend);
     MemAlloc mem = MemAlloc::zero();
-    if(forceRebuild || shouldRebuildModel(outputPath, hashDigest, mem)) {
-        // Generate modules
-        mem = generateRunner(outputPath, modelMerged, backend);
-        generateSynapseUpdate(outputPath, modelMerged, backend);
-        generateNeuronUpdate(outputPath, modelMerged, backend);
-        generateCustomUpdate(outputPath, modelMerged, backend);
-        generateInit(outputPath, modelMerged, backend);
+    std::unordered_map<std::string, boost::uuids::detail::sha1::digest_type> previousModuleHashDigests;
+    if(forceRebuild || shouldRebuildModel(outputPath, hashDigest, mem, previousModuleHashDigests)) {
+        // Build list of code generation tasks, starting with the runner
+        // **NOTE** modelMerged is not modified during code generation so it can be safely shared between tasks
+        std::vector<std::pair<std::string, std::function<void()>>> tasks;
+        tasks.emplace_back("runner", 
+                           [&mem, &outputPath, &modelMerged, &backend]()
+                           { 
+                               mem = generateRunner(outputPath, modelMerged, backend); 
+                           });
+
+        // Loop through modules
+        std::vector<std::pair<std::string, boost::uuids::detail::sha1::digest_type>> moduleHashDigests;
+        for(const auto &m : modules) {
+            // Calculate hash digest of module
+            const auto moduleHashDigest = (modelMerged.*m.getHashDigest)(backend);
+            moduleHashDigests.emplace_back(m.name, moduleHashDigest);
+
+            // If force rebuild flag is set, module has changed or its code is missing, add task to generate it
+            const auto previousModuleHashDigest = previousModuleHashDigests.find(m.name);
+            if(forceRebuild || previousModuleHashDigest == previousModuleHashDigests.cend()
+               || previousModuleHashDigest->second != moduleHashDigest
+               || !(outputPath / (m.name + ".cc")).exists())
+            {
+                LOGD_CODE_GEN << "Module '" << m.name << "' changed - re-generating code";
+                tasks.emplace_back(m.name, 
+                                   [&m, &outputPath, &modelMerged, &backend]()
+                                   { 
+                                       m.generate(outputPath, modelMerged, backend, ""); 
+                                   });
+            }
+            else {
+                LOGD_CODE_GEN << "Module '" << m.name << "' unchanged - skipping code generation";
+            }
+        }
 
         // Generate support code module if the backend supports namespaces
         if(backend.supportsNamespace()) {
-            generateSupportCode(outputPath, modelMerged);
+            tasks.emplace_back("supportCode", 
+                               [&outputPath, &modelMerged]()
+                               { 
+                                   generateSupportCode(outputPath, modelMerged); 
+                               });
         }
 
+        // Generate modules concurrently
+        runGenerationTasks(tasks);
+
         // Get list of files to copy into generated code
         const auto backendSharePath = sharePath / "backends";
         const auto filesToCopy = backend.getFilesToCopy(modelMerged);
@@ -137,6 +262,16 @@ std::pair<std::vector<std::string>, MemAlloc> CodeGenerator::generateAll(const M
         // Write model memory usage estimates so it can be reloaded if code doesn't need re-generating
         os << std::dec;
         os << mem << std::endl;
+
+        // Write name and hash digest of each module so they can be individually re-generated
+        os << std::hex;
+        for(const auto &m : moduleHashDigests) {
+            os << m.first;
+            for(const auto d : m.second) {
+                os << " " << d;
+            }
+            os << std::endl;
+        }
     }
 
     // Show memory usage
@@ -177,8 +312,8 @@ std::pair<std::vector<std::string>, MemAlloc> CodeGenerator::generateAll(const M
 void CodeGenerator::generateNeuronUpdate(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
                                          const BackendBase &backend, const std::string &suffix)
 {
-    // Create output stream to write to file and wrap in CodeStream
-    std::ofstream neuronUpdateStream((outputPath / ("neuronUpdate" + suffix + ".cc")).str());
+    // Create output stream to generate code into and wrap in CodeStream
+    std::ostringstream neuronUpdateStream;
     CodeStream neuronUpdate(neuronUpdateStream);
 
     neuronUpdate << "#include \"definitionsInternal" << suffix << ".h\"" << std::endl;
@@ -201,13 +336,16 @@ void CodeGenerator::generateNeuronUpdate(const filesystem::path &outputPath, con
         {
             modelMerged.genScalarEGPPush<NeuronUpdateGroupMerged>(os, backend);
         });
+
+    // Write generated code to file
+    writeFileIfChanged((outputPath / ("neuronUpdate" + suffix + ".cc")).str(), neuronUpdateStream.str());
 }
 //--------------------------------------------------------------------------
 void CodeGenerator::generateCustomUpdate(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
                                          const BackendBase &backend, const std::string &suffix)
 {
-    // Create output stream to write to file and wrap in CodeStream
-    std::ofstream customUpdateStream((outputPath / ("customUpdate" + suffix + ".cc")).str());
+    // Create output stream to generate code into and wrap in CodeStream
+    std::ostringstream customUpdateStream;
     CodeStream customUpdate(customUpdateStream);
 
     customUpdate << "#include \"definitionsInternal" << suffix << ".h\"" << std::endl;
@@ -231,13 +369,16 @@ void CodeGenerator::generateCustomUpdate(const filesystem::path &outputPath, con
             modelMerged.genScalarEGPPush<CustomUpdateWUGroupMerged>(os, backend);
             modelMerged.genScalarEGPPush<CustomUpdateTransposeWUGroupMerged>(os, backend);
         });
+
+    // Write generated code to file
+    writeFileIfChanged((outputPath / ("customUpdate" + suffix + ".cc")).str(), customUpdateStream.str());
 }
 //--------------------------------------------------------------------------
 void CodeGenerator::generateSynapseUpdate(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
                                           const BackendBase &backend, const std::string &suffix)
 {
-    // Create output stream to write to file and wrap in CodeStream
-    std::ofstream synapseUpdateStream((outputPath / ("synapseUpdate" + suffix + ".cc")).str());
+    // Create output stream to generate code into and wrap in CodeStream
+    std::ostringstream synapseUpdateStream;
     CodeStream synapseUpdate(synapseUpdateStream);
 
     synapseUpdate << "#include \"definitionsInternal" << suffix << ".h\"" << std::endl;
@@ -263,13 +404,16 @@ void CodeGenerator::generateSynapseUpdate(const filesystem::path &outputPath, co
             modelMerged.genScalarEGPPush<PostsynapticUpdateGroupMerged>(os, backend);
             modelMerged.genScalarEGPPush<SynapseDynamicsGroupMerged>(os, backend);
         });
+
+    // Write generated code to file
+    writeFileIfChanged((outputPath / ("synapseUpdate" + suffix + ".cc")).str(), synapseUpdateStream.str());
 }
 //--------------------------------------------------------------------------
 void CodeGenerator::generateInit(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
                                  const BackendBase &backend, const std::string &suffix)
 {
-    // Create output stream to write to file and wrap in CodeStream
-    std::ofstream initStream((outputPath / ("init" + suffix + ".cc")).str());
+    // Create output stream to generate code into and wrap in CodeStream
+    std::ostringstream initStream;
     CodeStream init(initStream);
 
     init << "#include \"definitionsInternal" << suffix << ".h\"" << std::endl;
@@ -300,4 +444,7 @@ void CodeGenerator::generateInit(const filesystem::path &outputPath, const Model
             modelMerged.genScalarEGPPush<SynapseSparseInitGroupMerged>(os, backend);
             modelMerged.genScalarEGPPush<CustomWUUpdateSparseInitGroupMerged>(os, backend);
         });
+
+    // Write generated code to file
+    writeFileIfChanged((outputPath / ("init" + suffix + ".cc")).str(), initStream.str());
 }
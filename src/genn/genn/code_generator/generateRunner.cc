@@ -149,6 +149,22 @@ void genVarPushPullScope(CodeStream &definitionsFunc, CodeStream &runnerPushFunc
     }
 }
 //-------------------------------------------------------------------------
+void genVarRangePullScope(CodeStream &definitionsFunc, CodeStream &runnerPullFunc, VarLocation loc,
+                          bool automaticCopyEnabled, const std::string &description, std::function<void()> handler)
+{
+    // If this variable has a location that allows pulling and automatic copying isn't enabled
+    if(canPushPullVar(loc) && !automaticCopyEnabled) {
+        definitionsFunc << "EXPORT_FUNC void pull" << description << "RangeFromDevice(size_t offset, size_t count);" << std::endl;
+
+        runnerPullFunc << "void pull" << description << "RangeFromDevice(size_t offset, size_t count)";
+        {
+            CodeStream::Scope b(runnerPullFunc);
+            handler();
+        }
+        runnerPullFunc << std::endl;
+    }
+}
+//-------------------------------------------------------------------------
 void genVarGetterScope(CodeStream &definitionsFunc, CodeStream &runnerGetterFunc,
                        VarLocation loc, const std::string &description, 
                        const std::string &type, std::function<void()> handler)
@@ -478,6 +494,149 @@ void genCustomUpdate(const ModelSpecMerged &modelMerged, const BackendBase &back
         }
     }
 }
+//--------------------------------------------------------------------------
+std::vector<std::pair<std::string, unsigned int>> getRecordingBuffers(const ModelSpecInternal &model)
+{
+    // Build vector of recording buffer names and the number of words they require per timestep
+    std::vector<std::pair<std::string, unsigned int>> recordingBuffers;
+    for(const auto &n : model.getNeuronGroups()) {
+        const unsigned int numWords = ceilDivide(n.second.getNumNeurons(), 32) * model.getBatchSize();
+        if(n.second.isSpikeRecordingEnabled()) {
+            recordingBuffers.emplace_back("recordSpk" + n.first, numWords);
+        }
+        if(n.second.isSpikeEventRecordingEnabled()) {
+            recordingBuffers.emplace_back("recordSpkEvent" + n.first, numWords);
+        }
+    }
+    return recordingBuffers;
+}
+//--------------------------------------------------------------------------
+void genAsyncRecordingState(CodeStream &os, const ModelSpecInternal &model)
+{
+    const auto recordingBuffers = getRecordingBuffers(model);
+
+    os << "namespace" << std::endl;
+    {
+        CodeStream::Scope b(os);
+
+        // Host buffer which a completed recording window is copied into before being passed to callback
+        os << "struct RecordingSlot";
+        {
+            CodeStream::Scope b(os);
+            os << "RecordingWindow window;" << std::endl;
+            for(const auto &r : recordingBuffers) {
+                os << "std::vector<uint32_t> " << r.first << ";" << std::endl;
+            }
+        }
+        os << ";" << std::endl;
+        os << std::endl;
+
+        // Slots are passed between the simulation and the recording thread via free and full queues
+        os << "RecordingSlot recordingSlots[" << model.getNumAsyncRecordingBuffers() << "];" << std::endl;
+        os << "std::deque<RecordingSlot*> freeRecordingSlots;" << std::endl;
+        os << "std::deque<RecordingSlot*> fullRecordingSlots;" << std::endl;
+        os << "std::mutex recordingMutex;" << std::endl;
+        os << "std::condition_variable recordingCondition;" << std::endl;
+        os << "std::thread recordingThread;" << std::endl;
+        os << "bool recordingThreadStop = false;" << std::endl;
+        os << "RecordingCallback recordingCallback = nullptr;" << std::endl;
+        os << "void *recordingCallbackUserData = nullptr;" << std::endl;
+        os << "unsigned long long recordingWindowStart = 0;" << std::endl;
+        os << std::endl;
+
+        // Recording thread passes full slots to callback until it is stopped and no full slots remain
+        os << "void recordingThreadFunc()";
+        {
+            CodeStream::Scope b(os);
+            os << "std::unique_lock<std::mutex> lock(recordingMutex);" << std::endl;
+            os << "while(true)";
+            {
+                CodeStream::Scope b(os);
+                os << "recordingCondition.wait(lock, [](){ return recordingThreadStop || !fullRecordingSlots.empty(); });" << std::endl;
+                os << "if(fullRecordingSlots.empty())";
+                {
+                    CodeStream::Scope b(os);
+                    os << "return;" << std::endl;
+                }
+                os << "RecordingSlot *slot = fullRecordingSlots.front();" << std::endl;
+                os << "fullRecordingSlots.pop_front();" << std::endl;
+                os << std::endl;
+
+                // Call callback without lock held so simulation can continue to fill other slots
+                os << "lock.unlock();" << std::endl;
+                os << "recordingCallback(&slot->window, recordingCallbackUserData);" << std::endl;
+                os << "lock.lock();" << std::endl;
+                os << std::endl;
+                os << "freeRecordingSlots.push_back(slot);" << std::endl;
+                os << "recordingCondition.notify_all();" << std::endl;
+            }
+        }
+        os << std::endl;
+
+        // Copy timesteps recorded since start of window into a free slot and hand it to recording thread
+        // **NOTE** windows always end at multiples of numRecordingTimesteps so never wrap around recording buffer
+        os << "void dispatchRecordingWindow()";
+        {
+            CodeStream::Scope b(os);
+            os << "const unsigned int numTimesteps = (unsigned int)(iT - recordingWindowStart);" << std::endl;
+            os << "if(numTimesteps == 0)";
+            {
+                CodeStream::Scope b(os);
+                os << "return;" << std::endl;
+            }
+            os << "pullRecordingBuffersFromDevice();" << std::endl;
+            os << std::endl;
+
+            // Wait for free slot
+            os << "RecordingSlot *slot;" << std::endl;
+            {
+                CodeStream::Scope b(os);
+                os << "std::unique_lock<std::mutex> lock(recordingMutex);" << std::endl;
+                os << "recordingCondition.wait(lock, [](){ return !freeRecordingSlots.empty(); });" << std::endl;
+                os << "slot = freeRecordingSlots.front();" << std::endl;
+                os << "freeRecordingSlots.pop_front();" << std::endl;
+            }
+            os << std::endl;
+
+            os << "const unsigned int startTimestep = (unsigned int)(recordingWindowStart % numRecordingTimesteps);" << std::endl;
+            os << "slot->window.startTimestep = recordingWindowStart;" << std::endl;
+            os << "slot->window.numTimesteps = numTimesteps;" << std::endl;
+            for(const auto &r : recordingBuffers) {
+                os << "std::copy_n(&" << r.first << "[startTimestep * " << r.second << "], numTimesteps * " << r.second << ", slot->" << r.first << ".data());" << std::endl;
+                os << "slot->window." << r.first << " = slot->" << r.first << ".data();" << std::endl;
+            }
+            os << std::endl;
+
+            {
+                CodeStream::Scope b(os);
+                os << "std::lock_guard<std::mutex> lock(recordingMutex);" << std::endl;
+                os << "fullRecordingSlots.push_back(slot);" << std::endl;
+            }
+            os << "recordingCondition.notify_all();" << std::endl;
+            os << "recordingWindowStart = iT;" << std::endl;
+        }
+        os << std::endl;
+
+        // Stop recording thread once it has passed all full slots to callback
+        os << "void stopRecordingThread()";
+        {
+            CodeStream::Scope b(os);
+            os << "if(recordingThread.joinable())";
+            {
+                CodeStream::Scope b(os);
+                {
+                    CodeStream::Scope b(os);
+                    os << "std::lock_guard<std::mutex> lock(recordingMutex);" << std::endl;
+                    os << "recordingThreadStop = true;" << std::endl;
+                }
+                os << "recordingCondition.notify_all();" << std::endl;
+                os << "recordingThread.join();" << std::endl;
+                os << "recordingThreadStop = false;" << std::endl;
+            }
+        }
+    }
+    os << std::endl;
+}
 }   // Anonymous namespace
 
 //--------------------------------------------------------------------------
@@ -486,10 +645,11 @@ void genCustomUpdate(const ModelSpecMerged &modelMerged, const BackendBase &back
 MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
                                        const BackendBase &backend, const std::string &suffix)
 {
-    // Create output streams to write to file and wrap in CodeStreams
-    std::ofstream definitionsStream((outputPath / ("definitions" + suffix + ".h")).str());
-    std::ofstream definitionsInternalStream((outputPath / ("definitionsInternal" + suffix + ".h")).str());
-    std::ofstream runnerStream((outputPath / ("runner" + suffix + ".cc")).str());
+    // Create output streams to generate code into and wrap in CodeStreams
+    // **NOTE** code is only written to files if it has changed so unchanged files keep their timestamps
+    std::ostringstream definitionsStream;
+    std::ostringstream definitionsInternalStream;
+    std::ostringstream runnerStream;
     CodeStream definitions(definitionsStream);
     CodeStream definitionsInternal(definitionsInternalStream);
     CodeStream runner(runnerStream);
@@ -544,6 +704,18 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
     // Write runner preamble
     runner << "#include \"definitionsInternal" << suffix << ".h\"" << std::endl << std::endl;
 
+    // If recording data is handed asynchronously to a user callback, include standard threading headers
+    const bool asyncRecording = (model.isRecordingInUse() && model.getNumAsyncRecordingBuffers() > 0);
+    if(asyncRecording) {
+        runner << "// Standard C++ includes" << std::endl;
+        runner << "#include <condition_variable>" << std::endl;
+        runner << "#include <deque>" << std::endl;
+        runner << "#include <mutex>" << std::endl;
+        runner << "#include <thread>" << std::endl;
+        runner << "#include <vector>" << std::endl;
+        runner << std::endl;
+    }
+
     // Create codestreams to generate different sections of runner and definitions
     std::stringstream runnerVarDeclStream;
     std::stringstream runnerVarAllocStream;
@@ -1014,6 +1186,16 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
                         runnerPushFunc, runnerPullFunc, vars[i].type, vars[i].name + n.first,
                         n.second.getVarLocation(i), autoInitialized, count, mem, neuronStatePushPullFunctions);
 
+            // Generate function to pull contiguous range of neuron state variable
+            genVarRangePullScope(definitionsFunc, runnerPullFunc, n.second.getVarLocation(i), backend.getPreferences().automaticCopy,
+                                 vars[i].name + n.first,
+                                 [&]()
+                                 {
+                                     runnerPullFunc << "assert((offset + count) <= " << count << ");" << std::endl;
+                                     backend.genVariableRangePull(runnerPullFunc, vars[i].type, vars[i].name + n.first,
+                                                                  n.second.getVarLocation(i), "offset", "count");
+                                 });
+
             // Current variable push and pull functions
             genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getVarLocation(i),
                                 backend.getPreferences().automaticCopy, "Current" + vars[i].name + n.first,
@@ -1265,12 +1447,24 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
                 backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                  "unsigned int", "rowLength" + s.second.getName(), varLoc, s.second.getSrcNeuronGroup()->getNumNeurons(), mem);
 
-                // Target indices
-                backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                 s.second.getSparseIndType(), "ind" + s.second.getName(), varLoc, size, mem);
+                // If target indices are delta-encoded, allocate enough bytes for each row to be encoded
+                const bool deltaEncoded = s.second.isDeltaEncodedSparseIndEnabled();
+                const size_t deltaSize = s.second.getSrcNeuronGroup()->getNumNeurons() * s.second.getMaxDeltaEncodedRowBytes();
+                if(deltaEncoded) {
+                    if(!backend.isDeltaEncodedSparseIndSupported()) {
+                        throw std::runtime_error("Synapse group '" + s.second.getName() + "' uses delta-encoded sparse indices which are not supported by this backend.");
+                    }
+                    backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                     "uint8_t", "indDelta" + s.second.getName(), varLoc, deltaSize, mem);
+                }
+                // Otherwise, allocate target indices
+                else {
+                    backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                     s.second.getSparseIndType(), "ind" + s.second.getName(), varLoc, size, mem);
+                }
 
                 // **TODO** remap is not always required
-                if(backend.isPostsynapticRemapRequired() && !s.second.getWUModel()->getLearnPostCode().empty()) {
+                if(backend.isSynapseGroupPostsynapticRemapRequired(s.second)) {
                     const size_t postSize = (size_t)s.second.getTrgNeuronGroup()->getNumNeurons() * (size_t)s.second.getMaxSourceConnections();
 
                     // Allocate column lengths
@@ -1282,6 +1476,13 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
                                      "unsigned int", "remap" + s.second.getName(), VarLocation::DEVICE, postSize, mem);
                 }
 
+                // If synaptic input is gathered, allocate bitmask of presynaptic neurons which have spiked
+                if(backend.isPostsynapticGatherRequired(s.second)) {
+                    const size_t preSpikeWords = ((size_t)s.second.getSrcNeuronGroup()->getNumNeurons() + 31) / 32;
+                    backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                     "uint32_t", "preSpikeBits" + s.second.getName(), VarLocation::DEVICE, preSpikeWords, mem);
+                }
+
                 // Generate push and pull functions for sparse connectivity
                 genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, s.second.getSparseConnectivityLocation(),
                                     backend.getPreferences().automaticCopy, s.second.getName() + "Connectivity", connectivityPushPullFunctions,
@@ -1292,8 +1493,14 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
                                                                     s.second.getSparseConnectivityLocation(), autoInitialized, s.second.getSrcNeuronGroup()->getNumNeurons());
 
                                         // Target indices
-                                        backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,  s.second.getSparseIndType(), "ind" + s.second.getName(), 
-                                                                    s.second.getSparseConnectivityLocation(), autoInitialized, size);
+                                        if(deltaEncoded) {
+                                            backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, "uint8_t", "indDelta" + s.second.getName(),
+                                                                        s.second.getSparseConnectivityLocation(), autoInitialized, deltaSize);
+                                        }
+                                        else {
+                                            backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,  s.second.getSparseIndType(), "ind" + s.second.getName(), 
+                                                                        s.second.getSparseConnectivityLocation(), autoInitialized, size);
+                                        }
                                     });
             }
         }
@@ -1542,10 +1749,24 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
 
     // If model uses recording
     if(model.isRecordingInUse()) {
+        // Generate state used to hand recording data to user callback
+        if(asyncRecording) {
+            genAsyncRecordingState(runner, model);
+        }
+
         runner << "void allocateRecordingBuffers(unsigned int timesteps)";
         {
             CodeStream::Scope b(runner);
 
+            // Check recording buffers aren't being resized underneath recording thread
+            if(asyncRecording) {
+                runner << "if(recordingCallback != nullptr)";
+                {
+                    CodeStream::Scope b(runner);
+                    runner << "throw std::runtime_error(\"Recording callback set - cannot reallocate recording buffers\");" << std::endl;
+                }
+            }
+
             // Cache number of recording timesteps in global variable
             runner << "numRecordingTimesteps = timesteps;" << std::endl;
 
@@ -1627,6 +1848,63 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
             }
         }
         runner << std::endl;
+
+        if(asyncRecording) {
+            runner << "void flushRecordingBuffers()";
+            {
+                CodeStream::Scope b(runner);
+                runner << "if(recordingCallback == nullptr)";
+                {
+                    CodeStream::Scope b(runner);
+                    runner << "return;" << std::endl;
+                }
+
+                // Hand partial window to recording thread and wait until callback has been called on all slots
+                runner << "dispatchRecordingWindow();" << std::endl;
+                runner << "std::unique_lock<std::mutex> lock(recordingMutex);" << std::endl;
+                runner << "recordingCondition.wait(lock, [](){ return freeRecordingSlots.size() == " << model.getNumAsyncRecordingBuffers() << "; });" << std::endl;
+            }
+            runner << std::endl;
+
+            runner << "void setRecordingCallback(RecordingCallback callback, void *userData)";
+            {
+                CodeStream::Scope b(runner);
+
+                // Check recording buffer has been allocated
+                runner << "if(numRecordingTimesteps == 0)";
+                {
+                    CodeStream::Scope b(runner);
+                    runner << "throw std::runtime_error(\"Recording buffer not allocated - cannot set recording callback\");" << std::endl;
+                }
+
+                // Pass any data recorded so far to previous callback and stop its thread
+                runner << "flushRecordingBuffers();" << std::endl;
+                runner << "stopRecordingThread();" << std::endl;
+                runner << std::endl;
+
+                // Start new window at current timestep
+                runner << "recordingCallback = callback;" << std::endl;
+                runner << "recordingCallbackUserData = userData;" << std::endl;
+                runner << "recordingWindowStart = iT;" << std::endl;
+
+                // If a callback is provided, size all slots to hold entire recording buffer and start recording thread
+                runner << "if(callback != nullptr)";
+                {
+                    CodeStream::Scope b(runner);
+                    runner << "freeRecordingSlots.clear();" << std::endl;
+                    runner << "for(auto &s : recordingSlots)";
+                    {
+                        CodeStream::Scope b(runner);
+                        for(const auto &r : getRecordingBuffers(model)) {
+                            runner << "s." << r.first << ".resize(" << r.second << " * numRecordingTimesteps);" << std::endl;
+                        }
+                        runner << "freeRecordingSlots.push_back(&s);" << std::endl;
+                    }
+                    runner << "recordingThread = std::thread(recordingThreadFunc);" << std::endl;
+                }
+            }
+            runner << std::endl;
+        }
     }
 
     // ---------------------------------------------------------------------
@@ -1654,6 +1932,12 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
     {
         CodeStream::Scope b(runner);
 
+        // Wait for recording thread to pass any remaining full slots to callback
+        if(asyncRecording) {
+            runner << "stopRecordingThread();" << std::endl;
+            runner << "recordingCallback = nullptr;" << std::endl;
+        }
+
         // Generate backend-specific preamble
         backend.genFreeMemPreamble(runner, modelMerged);
 
@@ -1712,6 +1996,15 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
 
         // Write step time finalize logic to runner
         runner << runnerStepTimeFinaliseStream.str();
+
+        // If recording buffer is full, hand it to recording thread
+        if(asyncRecording) {
+            runner << "if(recordingCallback != nullptr && (iT % numRecordingTimesteps) == 0)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "dispatchRecordingWindow();" << std::endl;
+            }
+        }
     }
     runner << std::endl;
 
@@ -1721,6 +2014,26 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
     definitionsInternal << definitionsInternalVarStream.str();
     definitionsInternal << definitionsInternalFuncStream.str();
 
+    // ---------------------------------------------------------------------
+    // Recording window types
+    if(asyncRecording) {
+        // Window of recording data passed to callback, laid out like the recording buffers
+        // but starting at startTimestep and containing numTimesteps timesteps
+        definitions << "// Recording window" << std::endl;
+        definitions << "struct RecordingWindow";
+        {
+            CodeStream::Scope b(definitions);
+            definitions << "unsigned long long startTimestep;" << std::endl;
+            definitions << "unsigned int numTimesteps;" << std::endl;
+            for(const auto &r : getRecordingBuffers(model)) {
+                definitions << "uint32_t *" << r.first << ";" << std::endl;
+            }
+        }
+        definitions << ";" << std::endl;
+        definitions << "typedef void (*RecordingCallback)(const RecordingWindow *window, void *userData);" << std::endl;
+        definitions << std::endl;
+    }
+
     // ---------------------------------------------------------------------
     // Function definitions
     definitions << "// Runner functions" << std::endl;
@@ -1736,6 +2049,10 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
         definitions << "EXPORT_FUNC void allocateRecordingBuffers(unsigned int timesteps);" << std::endl;
         definitions << "EXPORT_FUNC void pullRecordingBuffersFromDevice();" << std::endl;
     }
+    if(asyncRecording) {
+        definitions << "EXPORT_FUNC void setRecordingCallback(RecordingCallback callback, void *userData);" << std::endl;
+        definitions << "EXPORT_FUNC void flushRecordingBuffers();" << std::endl;
+    }
     definitions << "EXPORT_FUNC void allocateMem(" << backend.getAllocateMemParams(modelMerged) << ");" << std::endl;
     definitions << "EXPORT_FUNC void freeMem();" << std::endl;
     definitions << "EXPORT_FUNC size_t getFreeDeviceMemBytes();" << std::endl;
@@ -1764,5 +2081,10 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
     definitions << "}  // extern \"C\"" << std::endl;
     definitionsInternal << "}  // extern \"C\"" << std::endl;
 
+    // Write generated code to files
+    writeFileIfChanged((outputPath / ("definitions" + suffix + ".h")).str(), definitionsStream.str());
+    writeFileIfChanged((outputPath / ("definitionsInternal" + suffix + ".h")).str(), definitionsInternalStream.str());
+    writeFileIfChanged((outputPath / ("runner" + suffix + ".cc")).str(), runnerStream.str());
+
     return mem;
 }
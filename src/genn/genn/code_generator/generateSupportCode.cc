@@ -1,7 +1,7 @@
 #include "code_generator/generateSupportCode.h"
 
 // Standard C++ includes
-#include <fstream>
+#include <sstream>
 #include <string>
 
 // GeNN code generator includes
@@ -15,7 +15,7 @@
 void CodeGenerator::generateSupportCode(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
                                         const std::string &suffix)
 {
-    std::ofstream supportCodeStream((outputPath / ("supportCode" + suffix + ".h")).str());
+    std::ostringstream supportCodeStream;
     CodeStream supportCode(supportCodeStream);
 
     supportCode << "#pragma once" << std::endl;
@@ -40,4 +40,7 @@ void CodeGenerator::generateSupportCode(const filesystem::path &outputPath, cons
     supportCode << "// support code for synapse dynamics update groups" << std::endl;
     modelMerged.genSynapseDynamicsSupportCode(supportCode);
     supportCode << std::endl;
+
+    // Write generated code to file
+    writeFileIfChanged((outputPath / ("supportCode" + suffix + ".h")).str(), supportCodeStream.str());
 }
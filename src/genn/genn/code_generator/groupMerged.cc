@@ -873,7 +873,9 @@ SynapseGroupMergedBase::SynapseGroupMergedBase(size_t index, const std::string &
                  [&backend](const SynapseGroupInternal &sg, size_t) { return std::to_string(backend.getSynapticMatrixRowStride(sg)); });
     }
     
-    if(role == Role::PostsynapticUpdate || role == Role::SparseInit) {
+    if(role == Role::PostsynapticUpdate || role == Role::SparseInit
+       || (role == Role::PresynapticUpdate && backend.isPostsynapticGatherRequired(getArchetype())))
+    {
         addField("unsigned int", "colStride",
                  [](const SynapseGroupInternal &sg, size_t) { return std::to_string(sg.getMaxSourceConnections()); });
     }
@@ -1041,15 +1043,30 @@ SynapseGroupMergedBase::SynapseGroupMergedBase(size_t index, const std::string &
     // Add pointers to connectivity data
     if(getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
         addWeightSharingPointerField("unsigned int", "rowLength", backend.getDeviceVarPrefix() + "rowLength");
-        addWeightSharingPointerField(getArchetype().getSparseIndType(), "ind", backend.getDeviceVarPrefix() + "ind");
+
+        // If target indices are delta-encoded, add pointer to encoded rows and their stride
+        if(getArchetype().isDeltaEncodedSparseIndEnabled()) {
+            addWeightSharingPointerField("uint8_t", "indDelta", backend.getDeviceVarPrefix() + "indDelta");
+            addField("unsigned int", "indDeltaStride",
+                     [](const SynapseGroupInternal &sg, size_t) { return std::to_string(sg.getMaxDeltaEncodedRowBytes()); });
+        }
+        else {
+            addWeightSharingPointerField(getArchetype().getSparseIndType(), "ind", backend.getDeviceVarPrefix() + "ind");
+        }
 
         // Add additional structure for postsynaptic access
-        if(backend.isPostsynapticRemapRequired() && !wum->getLearnPostCode().empty()
-           && (role == Role::PostsynapticUpdate || role == Role::SparseInit))
+        if(backend.isSynapseGroupPostsynapticRemapRequired(getArchetype())
+           && (role == Role::PostsynapticUpdate || role == Role::SparseInit
+               || (role == Role::PresynapticUpdate && backend.isPostsynapticGatherRequired(getArchetype()))))
         {
             addWeightSharingPointerField("unsigned int", "colLength", backend.getDeviceVarPrefix() + "colLength");
             addWeightSharingPointerField("unsigned int", "remap", backend.getDeviceVarPrefix() + "remap");
         }
+
+        // Add bitmask of presynaptic neurons which have spiked if synaptic input is gathered
+        if(role == Role::PresynapticUpdate && backend.isPostsynapticGatherRequired(getArchetype())) {
+            addWeightSharingPointerField("uint32_t", "preSpikeBits", backend.getDeviceVarPrefix() + "preSpikeBits");
+        }
     }
     else if(getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
         addWeightSharingPointerField("uint32_t", "gp", backend.getDeviceVarPrefix() + "gp");
@@ -1533,6 +1550,7 @@ CustomWUUpdateHostReductionGroupMerged::CustomWUUpdateHostReductionGroupMerged(s
     addField("unsigned int", "size",
              [&backend](const CustomUpdateWUInternal &cg, size_t) 
              {
-                 return std::to_string(cg.getSynapseGroup()->getMaxConnections() * (size_t)cg.getSynapseGroup()->getSrcNeuronGroup()->getNumNeurons()); 
+                 const SynapseGroupInternal *sgInternal = static_cast<const SynapseGroupInternal*>(cg.getSynapseGroup());
+                 return std::to_string(backend.getSynapticMatrixRowStride(*sgInternal) * (size_t)sgInternal->getSrcNeuronGroup()->getNumNeurons()); 
              });
 }
@@ -640,9 +640,14 @@ void SynapseSparseInitGroupMerged::generateInit(const BackendBase &backend, Code
                      modelMerged.getModel().getPrecision(), modelMerged.getModel().getBatchSize(),
                      [this](size_t v, size_t p) { return isWUVarInitParamHeterogeneous(v, p); },
                      [this](size_t v, size_t p) { return isWUVarInitDerivedParamHeterogeneous(v, p); },
-                     [&backend](CodeStream &os, const Substitutions &kernelSubs, BackendBase::Handler handler)
+                     [&backend, this](CodeStream &os, const Substitutions &kernelSubs, BackendBase::Handler handler)
                      {
-                         backend.genSparseSynapseVariableRowInit(os, kernelSubs, handler); 
+                         if(getArchetype().isDeltaEncodedSparseIndEnabled()) {
+                             backend.genDeltaEncodedSparseSynapseVariableRowInit(os, kernelSubs, handler);
+                         }
+                         else {
+                             backend.genSparseSynapseVariableRowInit(os, kernelSubs, handler); 
+                         }
                      });
 }
 
@@ -93,7 +93,7 @@ ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model, const BackendBa
                            {
                                return ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) && 
                                        (sg.isWUVarInitRequired()
-                                        || (backend.isPostsynapticRemapRequired() && !sg.getWUModel()->getLearnPostCode().empty())));
+                                        || backend.isSynapseGroupPostsynapticRemapRequired(sg)));
                            },
                            &SynapseGroupInternal::getWUInitHashDigest);
 
@@ -307,6 +307,10 @@ boost::uuids::detail::sha1::digest_type ModelSpecMerged::getHashDigest(const Bac
         Utils::updateHash(g.getHashDigest(), hash);
     }
 
+    // Update hash with number of asynchronous recording buffers
+    // **NOTE** this only effects the runner so it isn't included in the model or module hashes
+    Utils::updateHash(getModel().getNumAsyncRecordingBuffers(), hash);
+
     // Update hash with each group's variable locations
     // **NOTE** these only effects the runner - doesn't matter for modules so this is done he
     for(const auto &g : getModel().getNeuronGroups()) {
@@ -482,6 +486,76 @@ boost::uuids::detail::sha1::digest_type ModelSpecMerged::getInitArchetypeHashDig
     return hash.get_digest();
 }
 //----------------------------------------------------------------------------
+boost::uuids::detail::sha1::digest_type ModelSpecMerged::getNeuronUpdateModuleHashDigest(const BackendBase &backend) const
+{
+    boost::uuids::detail::sha1 hash;
+    updateModuleHash(hash, backend);
+
+    // Concatenate hash digests and memory spaces of neuron update groups
+    updateMergedGroupsHash(hash, m_MergedNeuronUpdateGroups);
+    updateMergedGroupsMemorySpaceHash(hash, m_MergedNeuronSpikeQueueUpdateGroups);
+    updateMergedGroupsMemorySpaceHash(hash, m_MergedNeuronPrevSpikeTimeUpdateGroups);
+
+    // Concatenate support code used by neuron update
+    // **NOTE** spike-like event thresholds use presynaptic update support code
+    m_NeuronUpdateSupportCode.updateHash(hash);
+    m_PostsynapticDynamicsSupportCode.updateHash(hash);
+    m_PresynapticUpdateSupportCode.updateHash(hash);
+
+    return hash.get_digest();
+}
+//----------------------------------------------------------------------------
+boost::uuids::detail::sha1::digest_type ModelSpecMerged::getSynapseUpdateModuleHashDigest(const BackendBase &backend) const
+{
+    boost::uuids::detail::sha1 hash;
+    updateModuleHash(hash, backend);
+
+    // Concatenate hash digests and memory spaces of synapse update groups
+    updateMergedGroupsHash(hash, m_MergedPresynapticUpdateGroups);
+    updateMergedGroupsHash(hash, m_MergedPostsynapticUpdateGroups);
+    updateMergedGroupsHash(hash, m_MergedSynapseDynamicsGroups);
+    updateMergedGroupsMemorySpaceHash(hash, m_MergedSynapseDendriticDelayUpdateGroups);
+
+    // Concatenate support code used by synapse update
+    m_PresynapticUpdateSupportCode.updateHash(hash);
+    m_PostsynapticUpdateSupportCode.updateHash(hash);
+    m_SynapseDynamicsSupportCode.updateHash(hash);
+
+    return hash.get_digest();
+}
+//----------------------------------------------------------------------------
+boost::uuids::detail::sha1::digest_type ModelSpecMerged::getCustomUpdateModuleHashDigest(const BackendBase &backend) const
+{
+    boost::uuids::detail::sha1 hash;
+    updateModuleHash(hash, backend);
+
+    // Concatenate hash digests and memory spaces of custom update groups
+    updateMergedGroupsHash(hash, m_MergedCustomUpdateGroups);
+    updateMergedGroupsHash(hash, m_MergedCustomUpdateWUGroups);
+    updateMergedGroupsHash(hash, m_MergedCustomUpdateTransposeWUGroups);
+    updateMergedGroupsMemorySpaceHash(hash, m_MergedCustomUpdateHostReductionGroups);
+    updateMergedGroupsMemorySpaceHash(hash, m_MergedCustomWUUpdateHostReductionGroups);
+
+    return hash.get_digest();
+}
+//----------------------------------------------------------------------------
+boost::uuids::detail::sha1::digest_type ModelSpecMerged::getInitModuleHashDigest(const BackendBase &backend) const
+{
+    boost::uuids::detail::sha1 hash;
+    updateModuleHash(hash, backend);
+
+    // Concatenate hash digests and memory spaces of initialisation groups
+    updateMergedGroupsHash(hash, m_MergedNeuronInitGroups);
+    updateMergedGroupsHash(hash, m_MergedCustomUpdateInitGroups);
+    updateMergedGroupsHash(hash, m_MergedCustomWUUpdateInitGroups);
+    updateMergedGroupsHash(hash, m_MergedSynapseInitGroups);
+    updateMergedGroupsHash(hash, m_MergedSynapseConnectivityInitGroups);
+    updateMergedGroupsHash(hash, m_MergedSynapseSparseInitGroups);
+    updateMergedGroupsHash(hash, m_MergedCustomWUUpdateSparseInitGroups);
+
+    return hash.get_digest();
+}
+//----------------------------------------------------------------------------
 bool ModelSpecMerged::anyPointerEGPs() const
 {
     // Loop through grouped merged EGPs
@@ -499,3 +573,19 @@ bool ModelSpecMerged::anyPointerEGPs() const
 
     return false;
 }
+//----------------------------------------------------------------------------
+void ModelSpecMerged::updateModuleHash(boost::uuids::detail::sha1 &hash, const BackendBase &backend) const
+{
+    // Concatenate hash digest of model properties
+    Utils::updateHash(getModel().getHashDigest(), hash);
+
+    // Concatenate hash digest of backend properties
+    Utils::updateHash(backend.getHashDigest(), hash);
+
+    // Concatenate hash digest of GeNN version
+    Utils::updateHash(GENN_VERSION, hash);
+
+    // Concatenate hash digest of git hash
+    // **NOTE** it would be nicer to actually treat git hash as a hash but not really important
+    Utils::updateHash(GIT_HASH, hash);
+}
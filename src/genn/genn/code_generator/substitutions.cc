@@ -3,6 +3,64 @@
 // GeNN code generator includes
 #include "code_generator/codeGenUtils.h"
 
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+//--------------------------------------------------------------------------
+/*! \brief Substitute all $(XXXX) in code, where XXXX is in vars (and sorts after minName if specified), in a single pass
+ 
+    **NOTE** code substituted for $(XXXX) is itself only subject to substitution by variables which sort after XXXX,
+    meaning that the result is the same as substituting each variable in vars in turn */
+//--------------------------------------------------------------------------
+void substituteVars(std::string &code, const std::map<std::string, std::string> &vars, const std::string *minName = nullptr)
+{
+    std::string output;
+    size_t copiedEnd = 0;
+    for(size_t start = code.find("$("); start != std::string::npos;) {
+        // Find closing bracket, stopping if there isn't one
+        const size_t end = code.find(')', start + 2);
+        if(end == std::string::npos) {
+            break;
+        }
+
+        // If variable between brackets should be substituted
+        const auto var = vars.find(code.substr(start + 2, end - start - 2));
+        if(var != vars.cend() && (minName == nullptr || var->first > *minName)) {
+            LOGD_CODE_GEN << "Substituting '$(" << var->first << ")' for '" << var->second << "'";
+
+            // Copy preceding code into output
+            output.append(code, copiedEnd, start - copiedEnd);
+
+            // If substitution itself contains variables, substitute them before copying into output
+            if(var->second.find("$(") != std::string::npos) {
+                std::string substitution = var->second;
+                substituteVars(substitution, vars, &var->first);
+                output.append(substitution);
+            }
+            else {
+                output.append(var->second);
+            }
+
+            // Continue searching after closing bracket
+            copiedEnd = end + 1;
+            start = code.find("$(", copiedEnd);
+        }
+        // Otherwise, continue searching from next character
+        else {
+            start = code.find("$(", start + 1);
+        }
+    }
+
+    // If any substitutions were made, copy remaining code into output and replace code with it
+    if(copiedEnd != 0) {
+        output.append(code, copiedEnd, std::string::npos);
+        code.swap(output);
+    }
+}
+}   // Anonymous namespace
+
 //--------------------------------------------------------------------------
 // CodeGenerator::Substitutions
 //--------------------------------------------------------------------------
@@ -98,10 +156,7 @@ void CodeGenerator::Substitutions::applyFuncs(std::string &code) const
 void CodeGenerator::Substitutions::applyVars(std::string &code) const
 {
     // Apply variable substitutions
-    for(const auto &v : m_VarSubstitutions) {
-        LOGD_CODE_GEN << "Substituting '$(" << v.first << ")' for '" << v.second << "'";
-        substitute(code, "$(" + v.first + ")", v.second);
-    }
+    substituteVars(code, m_VarSubstitutions);
 
     // If we have a parent, apply their variable substitutions too
     if(m_Parent) {
@@ -311,6 +311,11 @@ void CustomUpdateWU::finalize(unsigned int batchSize)
 {
     // Check variable reference types
     checkVarReferenceBatching(m_VarReferences, batchSize);
+
+    // Custom weight updates need to access the postsynaptic index of each synapse
+    if(getSynapseGroup()->isDeltaEncodedSparseIndEnabled()) {
+        throw std::runtime_error("Custom weight updates cannot be used on synapse groups with delta-encoded sparse indices.");
+    }
 }
 //----------------------------------------------------------------------------
 bool CustomUpdateWU::isTransposeOperation() const
@@ -242,6 +242,57 @@ void SynapseGroup::setNarrowSparseIndEnabled(bool enabled)
     }
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setTiledDenseUpdateEnabled(bool enabled)
+{
+    if(getMatrixType() & SynapseMatrixConnectivity::DENSE) {
+        m_TiledDenseUpdateEnabled = enabled;
+    }
+    else {
+        throw std::runtime_error("setTiledDenseUpdateEnabled: This function can only be used on synapse groups with dense connectivity.");
+    }
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::setPostsynapticGatherEnabled(bool enabled)
+{
+    if(isWeightSharingSlave()) {
+        throw std::runtime_error("setPostsynapticGatherEnabled: Synapse group is a weight sharing slave. Postsynaptic gather can only be enabled on the master.");
+    }
+    else {
+        if(getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+            m_PostsynapticGatherEnabled = enabled;
+        }
+        else {
+            throw std::runtime_error("setPostsynapticGatherEnabled: This function can only be used on synapse groups with sparse connectivity.");
+        }
+    }
+}
+//----------------------------------------------------------------------------
+bool SynapseGroup::isPostsynapticGatherEnabled() const
+{
+    return isWeightSharingSlave() ? getWeightSharingMaster()->isPostsynapticGatherEnabled() : m_PostsynapticGatherEnabled;
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::setDeltaEncodedSparseIndEnabled(bool enabled)
+{
+    if(isWeightSharingSlave()) {
+        throw std::runtime_error("setDeltaEncodedSparseIndEnabled: Synapse group is a weight sharing slave. Sparse index encoding can only be set on the master.");
+    }
+    else if(!(getMatrixType() & SynapseMatrixConnectivity::SPARSE)) {
+        throw std::runtime_error("setDeltaEncodedSparseIndEnabled: This function can only be used on synapse groups with sparse connectivity.");
+    }
+    else if(getConnectivityInitialiser().getSnippet()->getRowBuildCode().empty()) {
+        throw std::runtime_error("setDeltaEncodedSparseIndEnabled: This function can only be used on synapse groups whose connectivity is initialised using a snippet with row building code.");
+    }
+    else {
+        m_DeltaEncodedSparseIndEnabled = enabled;
+    }
+}
+//----------------------------------------------------------------------------
+bool SynapseGroup::isDeltaEncodedSparseIndEnabled() const
+{
+    return isWeightSharingSlave() ? getWeightSharingMaster()->isDeltaEncodedSparseIndEnabled() : m_DeltaEncodedSparseIndEnabled;
+}
+//----------------------------------------------------------------------------
 unsigned int SynapseGroup::getMaxConnections() const
 { 
     // **NOTE** these get retrived from weight sharing master 
@@ -295,6 +346,20 @@ std::string SynapseGroup::getSparseIndType() const
     return "uint32_t";
 }
 //----------------------------------------------------------------------------
+size_t SynapseGroup::getMaxDeltaEncodedRowBytes() const
+{
+    // Each delta requires one byte plus an extra byte for each further 7 bits it requires. Because
+    // rows are sorted, the deltas within a row sum to at most the largest postsynaptic index so,
+    // for example, at most (numTrgNeurons - 1) / 128 deltas can require a second byte
+    const size_t maxRowLength = getMaxConnections();
+    const size_t maxInd = std::max(1u, getTrgNeuronGroup()->getNumNeurons()) - 1;
+    size_t maxBytes = maxRowLength;
+    for(unsigned int shift = 7; shift < 32; shift += 7) {
+        maxBytes += std::min(maxRowLength, maxInd >> shift);
+    }
+    return maxBytes;
+}
+//----------------------------------------------------------------------------
 const std::vector<double> SynapseGroup::getWUConstInitVals() const
 {
     return getConstInitVals(m_WUVarInitialisers);
@@ -538,7 +603,7 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
                            const InitToeplitzConnectivitySnippet::Init &toeplitzInitialiser,
                            VarLocation defaultVarLocation, VarLocation defaultExtraGlobalParamLocation,
                            VarLocation defaultSparseConnectivityLocation, bool defaultNarrowSparseIndEnabled)
-    :   m_Name(name), m_SpanType(SpanType::POSTSYNAPTIC), m_NumThreadsPerSpike(1), m_DelaySteps(delaySteps), m_BackPropDelaySteps(0),
+    :   m_Name(name), m_SpanType(SpanType::POSTSYNAPTIC), m_NumThreadsPerSpike(1), m_TiledDenseUpdateEnabled(false), m_PostsynapticGatherEnabled(false), m_DeltaEncodedSparseIndEnabled(false), m_DelaySteps(delaySteps), m_BackPropDelaySteps(0),
         m_MaxDendriticDelayTimesteps(1), m_MatrixType(matrixType),  m_SrcNeuronGroup(srcNeuronGroup), m_TrgNeuronGroup(trgNeuronGroup), m_WeightSharingMaster(weightSharingMaster),
         m_EventThresholdReTestRequired(false), m_NarrowSparseIndEnabled(defaultNarrowSparseIndEnabled),
         m_InSynLocation(defaultVarLocation),  m_DendriticDelayLocation(defaultVarLocation),
@@ -843,9 +908,12 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getWUHashDigest() const
     Utils::updateHash(getBackPropDelaySteps(), hash);
     Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
     Utils::updateHash(getSparseIndType(), hash);
+    Utils::updateHash(isDeltaEncodedSparseIndEnabled(), hash);
     Utils::updateHash(getNumThreadsPerSpike(), hash);
     Utils::updateHash(isEventThresholdReTestRequired(), hash);
     Utils::updateHash(getSpanType(), hash);
+    Utils::updateHash(isTiledDenseUpdateEnabled(), hash);
+    Utils::updateHash(isPostsynapticGatherEnabled(), hash);
     Utils::updateHash(isPSModelFused(), hash);
     Utils::updateHash(getSrcNeuronGroup()->getNumDelaySlots(), hash);
     Utils::updateHash(getTrgNeuronGroup()->getNumDelaySlots(), hash);
@@ -1022,10 +1090,12 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getWUInitHashDigest() cons
     boost::uuids::detail::sha1 hash;
     Utils::updateHash(getMatrixType(), hash);
     Utils::updateHash(getSparseIndType(), hash);
+    Utils::updateHash(isDeltaEncodedSparseIndEnabled(), hash);
     Utils::updateHash(getWUModel()->getVars(), hash);
 
     Utils::updateHash(getWUModel()->getSynapseDynamicsCode().empty(), hash);
     Utils::updateHash(getWUModel()->getLearnPostCode().empty(), hash);
+    Utils::updateHash(isPostsynapticGatherEnabled(), hash);
 
     // Include variable initialiser hashes
     for(const auto &w : getWUVarInitialisers()) {
@@ -1083,6 +1153,7 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getConnectivityInitHashDig
     Utils::updateHash(getConnectivityInitialiser().getHashDigest(), hash);
     Utils::updateHash(getMatrixType(), hash);
     Utils::updateHash(getSparseIndType(), hash);
+    Utils::updateHash(isDeltaEncodedSparseIndEnabled(), hash);
     return hash.get_digest();
 }
 //----------------------------------------------------------------------------
@@ -0,0 +1,232 @@
+#include "binaryConnectionList.h"
+
+// Standard C++ includes
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+// Standard C includes
+#include <cmath>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <sys/stat.h>
+#else
+// POSIX C includes
+extern "C"
+{
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+#endif
+
+// SpineML common includes
+#include "spineMLLogging.h"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Connection lists with fewer synapses than this are processed on a single thread
+const size_t minParallelConnections = 1 << 20;
+}   // Anonymous namespace
+
+//----------------------------------------------------------------------------
+// SpineMLCommon::BinaryConnectionList
+//----------------------------------------------------------------------------
+SpineMLCommon::BinaryConnectionList::BinaryConnectionList(const std::string &filename, unsigned int numConnections, bool explicitDelay)
+:   m_Filename(filename), m_NumConnections(numConnections), m_WordsPerSynapse(explicitDelay ? 3 : 2), m_Words(nullptr)
+{
+    const uint64_t requiredBytes = (uint64_t)numConnections * m_WordsPerSynapse * sizeof(uint32_t);
+
+#ifdef _WIN32
+    // Open file and get it's size
+    struct _stat64 fileStat;
+    if(_stat64(filename.c_str(), &fileStat) != 0) {
+        throw std::runtime_error("Cannot open binary connection file:" + filename);
+    }
+    const uint64_t fileSize = fileStat.st_size;
+
+    m_File = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(m_File == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Cannot open binary connection file:" + filename);
+    }
+#else
+    // Open file and get it's size
+    const int file = open(filename.c_str(), O_RDONLY);
+    if(file == -1) {
+        throw std::runtime_error("Cannot open binary connection file:" + filename);
+    }
+    struct stat fileStat;
+    if(fstat(file, &fileStat) != 0) {
+        close(file);
+        throw std::runtime_error("Cannot open binary connection file:" + filename);
+    }
+    const uint64_t fileSize = fileStat.st_size;
+#endif
+
+    // Check file contains enough data
+    if(fileSize < requiredBytes) {
+#ifdef _WIN32
+        CloseHandle(m_File);
+#else
+        close(file);
+#endif
+        throw std::runtime_error("Unexpected end of binary connection file");
+    }
+
+    // If there's anything to read, map file into memory
+    // **NOTE** file descriptor can be closed once mapping is created
+    if(requiredBytes > 0) {
+#ifdef _WIN32
+        m_Mapping = CreateFileMapping(m_File, NULL, PAGE_READONLY, 0, 0, NULL);
+        if(m_Mapping == NULL) {
+            CloseHandle(m_File);
+            throw std::runtime_error("Cannot map binary connection file:" + filename);
+        }
+        m_Words = reinterpret_cast<const uint32_t*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, (SIZE_T)requiredBytes));
+        if(m_Words == nullptr) {
+            CloseHandle(m_Mapping);
+            CloseHandle(m_File);
+            throw std::runtime_error("Cannot map binary connection file:" + filename);
+        }
+#else
+        void *words = mmap(nullptr, requiredBytes, PROT_READ, MAP_PRIVATE, file, 0);
+        close(file);
+        if(words == MAP_FAILED) {
+            throw std::runtime_error("Cannot map binary connection file:" + filename);
+        }
+
+        // File is read sequentially by each thread
+        madvise(words, requiredBytes, MADV_SEQUENTIAL);
+        m_Words = reinterpret_cast<const uint32_t*>(words);
+#endif
+    }
+    else {
+#ifdef _WIN32
+        m_Mapping = NULL;
+#else
+        close(file);
+#endif
+    }
+}
+//----------------------------------------------------------------------------
+SpineMLCommon::BinaryConnectionList::~BinaryConnectionList()
+{
+#ifdef _WIN32
+    if(m_Words != nullptr) {
+        UnmapViewOfFile(m_Words);
+    }
+    if(m_Mapping != NULL) {
+        CloseHandle(m_Mapping);
+    }
+    CloseHandle(m_File);
+#else
+    if(m_Words != nullptr) {
+        munmap(const_cast<uint32_t*>(m_Words), (size_t)m_NumConnections * m_WordsPerSynapse * sizeof(uint32_t));
+    }
+#endif
+}
+//----------------------------------------------------------------------------
+void SpineMLCommon::BinaryConnectionList::parallelFor(std::function<void(size_t, size_t)> func) const
+{
+    parallelFor(m_NumConnections, func);
+}
+//----------------------------------------------------------------------------
+void SpineMLCommon::BinaryConnectionList::parallelForRows(unsigned int numRows, std::function<void(size_t, size_t)> func) const
+{
+    parallelFor(numRows, func);
+}
+//----------------------------------------------------------------------------
+void SpineMLCommon::BinaryConnectionList::parallelFor(size_t numItems, std::function<void(size_t, size_t)> func) const
+{
+    // If list is small, process all items on this thread
+    const size_t numThreads = std::max(1u, std::thread::hardware_concurrency());
+    if(m_NumConnections < minParallelConnections || numThreads == 1 || numItems < numThreads) {
+        func(0, numItems);
+    }
+    // Otherwise, split items evenly between threads
+    else {
+        const size_t chunkSize = (numItems + numThreads - 1) / numThreads;
+        std::vector<std::thread> threads;
+        for(size_t begin = 0; begin < numItems; begin += chunkSize) {
+            threads.emplace_back(func, begin, std::min(begin + chunkSize, numItems));
+        }
+
+        for(auto &t : threads) {
+            t.join();
+        }
+    }
+}
+//----------------------------------------------------------------------------
+SpineMLCommon::BinaryConnectionList::Summary SpineMLCommon::BinaryConnectionList::getSummary(unsigned int numPre) const
+{
+    LOGD_SPINEML << "\tScanning binary connection file:" << m_Filename;
+
+    // Atomic row length histogram shared between threads
+    std::vector<std::atomic<unsigned int>> rowLengths(numPre);
+    for(auto &r : rowLengths) {
+        r.store(0, std::memory_order_relaxed);
+    }
+
+    // Delay range found by each thread
+    std::mutex delayMutex;
+    float minDelayMs = std::numeric_limits<float>::max();
+    float maxDelayMs = std::numeric_limits<float>::lowest();
+    bool invalidPre = false;
+
+    parallelFor(
+        [&](size_t begin, size_t end)
+        {
+            // Update row length histogram
+            float threadMinDelayMs = std::numeric_limits<float>::max();
+            float threadMaxDelayMs = std::numeric_limits<float>::lowest();
+            bool threadInvalidPre = false;
+            for(size_t i = begin; i < end; i++) {
+                const uint32_t pre = getPre(i);
+                if(pre < numPre) {
+                    rowLengths[pre].fetch_add(1, std::memory_order_relaxed);
+                }
+                else {
+                    threadInvalidPre = true;
+                }
+
+                // If this file contains explicit delays, update range
+                if(hasExplicitDelay()) {
+                    const float delay = getDelay(i);
+                    threadMinDelayMs = std::min(threadMinDelayMs, delay);
+                    threadMaxDelayMs = std::max(threadMaxDelayMs, delay);
+                }
+            }
+
+            // Combine delay range with other threads
+            std::lock_guard<std::mutex> lock(delayMutex);
+            minDelayMs = std::min(minDelayMs, threadMinDelayMs);
+            maxDelayMs = std::max(maxDelayMs, threadMaxDelayMs);
+            invalidPre = invalidPre || threadInvalidPre;
+        });
+
+    if(invalidPre) {
+        throw std::runtime_error("Binary connection file '" + m_Filename + "' contains out of range presynaptic index");
+    }
+
+    // Calculate max row length from histogram
+    unsigned int maxRowLength = 0;
+    for(const auto &r : rowLengths) {
+        maxRowLength = std::max(maxRowLength, r.load(std::memory_order_relaxed));
+    }
+
+    // If file contains explicit delays, delays are heterogeneous if they span a range
+    if(hasExplicitDelay() && m_NumConnections > 0) {
+        return Summary{maxRowLength, minDelayMs != maxDelayMs, maxDelayMs};
+    }
+    else {
+        return Summary{maxRowLength, false, std::numeric_limits<float>::quiet_NaN()};
+    }
+}
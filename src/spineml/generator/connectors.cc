@@ -21,6 +21,7 @@
 #include "synapseMatrixType.h"
 
 // SpineML common includes
+#include "binaryConnectionList.h"
 #include "spineMLLogging.h"
 
 //----------------------------------------------------------------------------
@@ -85,77 +86,30 @@ std::tuple<unsigned int, List::DelayType, float> List::readMaxRowLengthAndDelay(
                                                                                 unsigned int numPre, unsigned int)
 {
     // If connectivity should be read from a binary file
-    std::vector<unsigned int> rowLengths(numPre, 0);
     auto binaryFile = node.child("BinaryFile");
 
     bool explicitDelay = false;
     bool heterogenousDelay = false;
     float maxDelayMs = std::numeric_limits<float>::quiet_NaN();
     unsigned int numConnections = 0;
+    unsigned int maxRowLength = 0;
 
     if(binaryFile) {
-        // Create approximately 1Mbyte buffer to hold pre and postsynaptic indices
-        // **NOTE** this is also a multiple of both 2 and 3 so
-        // will hold a whole number of either format of synapse
-        const unsigned int bufferSize = 2 * 3 * 43690;
-        std::vector<uint32_t> connectionBuffer(bufferSize);
-
-        // If there are individual delays then each synapse is 3 words rather than 2
+        // Memory map binary connection file
         explicitDelay = (binaryFile.attribute("explicit_delay_flag").as_uint() != 0);
-        const unsigned int wordsPerSynapse = explicitDelay ? 3 : 2;
-
-        // Read number of connections and filename of file fr
         numConnections = binaryFile.attribute("num_connections").as_uint();
-        std::string filename = (basePath / binaryFile.attribute("file_name").value()).str();
-
-        // Open file for binary IO
-        std::ifstream input(filename, std::ios::binary);
-        if(!input.good()) {
-            throw std::runtime_error("Cannot open binary connection file:" + filename);
-        }
-
-        // Loop through
-        for(size_t remainingWords = numConnections * wordsPerSynapse; remainingWords > 0;) {
-            // Read a block into buffer
-            const size_t blockWords = std::min<size_t>(bufferSize, remainingWords);
-            input.read(reinterpret_cast<char*>(connectionBuffer.data()), blockWords * sizeof(uint32_t));
-
-            // Check block was read succesfully
-            if((size_t)input.gcount() != (blockWords * sizeof(uint32_t))) {
-                throw std::runtime_error("Unexpected end of binary connection file");
-            }
-
-            // Loop through presynaptic words in buffer
-            for(size_t w = 0; w < blockWords; w += wordsPerSynapse) {
-                // Update row length histogram
-                rowLengths[connectionBuffer[w]]++;
-
-                // If this file contains explicit delays
-                if(explicitDelay) {
-                    // Cast delay word to float
-                    const float *synapseDelay = reinterpret_cast<float*>(&connectionBuffer[w + 2]);
-
-                    // If this is our first delay, use this as initial maximum
-                    if(std::isnan(maxDelayMs)) {
-                        maxDelayMs = *synapseDelay;
-                    }
-                    // Otherwise, if this delay isn't the same as our current max
-                    else if(maxDelayMs != *synapseDelay) {
-                        // Delays must be heterogenous
-                        heterogenousDelay = true;
-
-                        // Update maximum delay
-                        maxDelayMs = std::max(maxDelayMs, *synapseDelay);
-                    }
-                }
-            }
-
-            // Subtract words in block from total
-            remainingWords -= blockWords;
-        }
+        const std::string filename = (basePath / binaryFile.attribute("file_name").value()).str();
+        SpineMLCommon::BinaryConnectionList connectionList(filename, numConnections, explicitDelay);
+
+        // Get summary of connectivity by scanning binary file in parallel
+        const auto summary = connectionList.getSummary(numPre);
+        maxRowLength = summary.maxRowLength;
+        heterogenousDelay = summary.heterogeneousDelay;
+        maxDelayMs = summary.maxDelayMs;
     }
     // Otherwise loop through connections
     else {
+        std::vector<unsigned int> rowLengths(numPre, 0);
         for(auto c : node.children("Connection")) {
             // Increment histogram bin based on source neuron
             rowLengths[c.attribute("src_neuron").as_uint()]++;
@@ -187,10 +141,10 @@ std::tuple<unsigned int, List::DelayType, float> List::readMaxRowLengthAndDelay(
                 throw std::runtime_error("GeNN doesn't support connection lists with partial explicit delays");
             }
         }
-    }
 
-    // Calculate max row length from histogram
-    const unsigned int maxRowLength = *std::max_element(rowLengths.begin(), rowLengths.end());
+        // Calculate max row length from histogram
+        maxRowLength = *std::max_element(rowLengths.begin(), rowLengths.end());
+    }
 
     // If there are explicit delays
     if(explicitDelay) {
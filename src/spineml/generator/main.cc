@@ -308,6 +308,19 @@ int main(int argc, char *argv[])
             }
         }
 
+        // Loop through loggers which write to file
+        // **NOTE** event logging to network is not supported
+        std::map<std::string, std::set<std::string>> loggedPorts;
+        for(auto logOutput : experiment.children("LogOutput")) {
+            if(logOutput.attribute("host").empty()) {
+                const std::string target = SpineMLUtils::getSafeName(logOutput.attribute("target").value());
+                const std::string port = logOutput.attribute("port").value();
+
+                LOGD_SPINEML << "\tLog targetting: " << target << ":" << port;
+                loggedPorts[target].emplace(port);
+            }
+        }
+
         // Get model
         auto experimentModel = experiment.child("Model");
         if(!experimentModel) {
@@ -412,9 +425,17 @@ int main(int argc, char *argv[])
                 const auto &neuronModel = getCreateModel(modelParams, neuronModels);
 
                 // Add population to model
-                model.addNeuronPopulation(popName, popSize, &neuronModel,
-                                          NeuronModel::ParamValues(varInitialisers, neuronModel),
-                                          NeuronModel::VarValues(varInitialisers, neuronModel));
+                auto *neuronPop = model.addNeuronPopulation(popName, popSize, &neuronModel,
+                                                            NeuronModel::ParamValues(varInitialisers, neuronModel),
+                                                            NeuronModel::VarValues(varInitialisers, neuronModel));
+
+                // If spikes emitted by population are logged, use spike recording so
+                // simulator can pull them from device in blocks rather than every timestep
+                const auto *loggedPortNames = getNamedSet(loggedPorts, popName);
+                if(loggedPortNames != nullptr && loggedPortNames->count(neuronModel.getSendPortSpike()) > 0) {
+                    LOGD_SPINEML << "\tRecording spikes";
+                    neuronPop->setSpikeRecordingEnabled(true);
+                }
             }
         }
 
@@ -640,7 +661,7 @@ int main(int argc, char *argv[])
         // **NOTE** scope requiredso it gets closed before being built
         {
             std::ofstream makefile((codePath / "Makefile").str());
-            CodeGenerator::generateMakefile(makefile, backend, moduleNames);
+            CodeGenerator::generateMakefile(makefile, model, backend, moduleNames);
         }
 
         // Generate command to build using make, using as many threads as possible
@@ -315,7 +315,7 @@ void SpineMLGenerator::wrapAndReplaceVariableNames(std::string &code, const std:
                                                    const std::string &replaceVariableName)
 {
     // Replace variable name with replacement variable name, within GeNN $(XXXX) wrapper
-    CodeGenerator::regexVarSubstitute(code, variableName, "$(" + replaceVariableName + ")");
+    CodeGenerator::varSubstitute(code, variableName, "$(" + replaceVariableName + ")");
 }
 //----------------------------------------------------------------------------
 void SpineMLGenerator::wrapVariableNames(std::string &code, const std::string &variableName)
@@ -2,8 +2,9 @@
 
 // Standard C++ includes
 #include <algorithm>
-#include <fstream>
+#include <atomic>
 #include <iostream>
+#include <memory>
 #include <numeric>
 #include <random>
 #include <tuple>
@@ -11,6 +12,7 @@
 
 // Standard C includes
 #include <cassert>
+#include <cmath>
 #include <cstdint>
 
 // Filesystem includes
@@ -20,6 +22,7 @@
 #include "pugixml/pugixml.hpp"
 
 // SpineML common includes
+#include "binaryConnectionList.h"
 #include "spineMLLogging.h"
 
 //------------------------------------------------------------------------
@@ -47,70 +50,65 @@ void createListSparse(const pugi::xml_node &node, double dt, unsigned int numPre
                                             std::numeric_limits<unsigned int>::max());
 
     // If connectivity is specified using a binary file
+    std::unique_ptr<SpineMLCommon::BinaryConnectionList> connectionList;
     if(binaryFile) {
-        // Create approximately 1Mbyte buffer to hold pre and postsynaptic indices
-        // **NOTE** this is also a multiple of both 2 and 3 so
-        // will hold a whole number of either format of synapse
-        const unsigned int bufferSize = 2 * 3 * 43690;
-        std::vector<uint32_t> connectionBuffer(bufferSize);
-
         // If there are individual delays then each synapse is 3 words rather than 2
         const bool explicitDelay = (binaryFile.attribute("explicit_delay_flag").as_uint() != 0);
-        const unsigned int wordsPerSynapse = explicitDelay ? 3 : 2;
 
         // If this connection has explict delays and no delay array was found, error
         if(explicitDelay && delay == nullptr) {
             throw std::runtime_error("Cannot build list connector with explicit delay - delay variable not found");
         }
 
-        // Read binary connection filename from node
-        std::string filename = (basePath / binaryFile.attribute("file_name").value()).str();
+        // Read binary connection filename from node and memory map file
+        const std::string filename = (basePath / binaryFile.attribute("file_name").value()).str();
+        connectionList.reset(new SpineMLCommon::BinaryConnectionList(filename, numConnections, explicitDelay));
 
-        // Open file for binary IO
-        std::ifstream input(filename, std::ios::binary);
-        if(!input.good()) {
-            throw std::runtime_error("Cannot open binary connection file:" + filename);
+        // Create atomic row lengths so synapses can be scattered into rows in parallel
+        // **NOTE** the generator has already calculated the maximum row length so only one pass is required
+        std::vector<std::atomic<unsigned int>> atomicRowLength(numPre);
+        for(auto &r : atomicRowLength) {
+            r.store(0, std::memory_order_relaxed);
         }
 
-        // Loop through binary words
-        unsigned int i = 0;
-        for(size_t remainingWords = numConnections * wordsPerSynapse; remainingWords > 0;) {
-            // Read a block into buffer
-            const size_t blockWords = std::min<size_t>(bufferSize, remainingWords);
-            input.read(reinterpret_cast<char*>(connectionBuffer.data()), blockWords * sizeof(uint32_t));
-
-            // Check block was read succesfully
-            if((size_t)input.gcount() != (blockWords * sizeof(uint32_t))) {
-                throw std::runtime_error("Unexpected end of binary connection file");
-            }
-
-            // Loop through synapses in buffer
-            for(size_t w = 0; w < blockWords; w += wordsPerSynapse) {
-                const unsigned int pre = connectionBuffer[w];
-                const unsigned int post = connectionBuffer[w + 1];
-
-                // Add postsynaptic index to ragged data structure and record creation order
-                const size_t index = (pre * maxRowLength) + rowLength[pre];
-                ind[index] = post;
-                originalOrder[index] = i++;
-
-                // If this file contains explicit delays
-                if(explicitDelay) {
-                    // Cast delay word to float
-                    const float *synDelay = reinterpret_cast<float*>(&connectionBuffer[w + 2]);
-
-                    // Store in delay array
-                    (*delay)[index] = (uint8_t)std::round(*synDelay / dt);
+        // Loop through ranges of synapses in parallel
+        std::atomic<bool> invalidConnection{false};
+        connectionList->parallelFor(
+            [&](size_t begin, size_t end)
+            {
+                for(size_t i = begin; i < end; i++) {
+                    const unsigned int pre = connectionList->getPre(i);
+                    if(pre >= numPre) {
+                        invalidConnection.store(true, std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    // Reserve slot in row
+                    const unsigned int j = atomicRowLength[pre].fetch_add(1, std::memory_order_relaxed);
+                    if(j >= maxRowLength) {
+                        invalidConnection.store(true, std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    // Add postsynaptic index to ragged data structure and record creation order
+                    const size_t index = ((size_t)pre * maxRowLength) + j;
+                    ind[index] = connectionList->getPost(i);
+                    originalOrder[index] = (unsigned int)i;
+
+                    // If this file contains explicit delays, store in delay array
+                    if(explicitDelay) {
+                        (*delay)[index] = (uint8_t)std::round(connectionList->getDelay(i) / dt);
+                    }
                 }
+            });
 
-                // Increment row length
-                rowLength[pre]++;
-                assert(rowLength[pre] <= maxRowLength);
-            }
-
-            // Subtract words in block from totalConnectors
-            remainingWords -= blockWords;
+        if(invalidConnection.load()) {
+            throw std::runtime_error("Binary connection file:" + filename + " does not fit in connectivity allocated by generator");
         }
+
+        // Copy row lengths into GeNN array
+        std::transform(atomicRowLength.cbegin(), atomicRowLength.cend(), rowLength,
+                       [](const std::atomic<unsigned int> &r){ return r.load(std::memory_order_relaxed); });
     }
     // Otherwise loop through connections and add to projection
     else {
@@ -149,57 +147,73 @@ void createListSparse(const pugi::xml_node &node, double dt, unsigned int numPre
     // Reserve remap indices array to match number of connections
     remapIndices.resize(numConnections);
 
-    // Create array of row indices to use for sorting each row
-    std::vector<unsigned int> rowOrder(maxRowLength);
-    std::vector<unsigned int> rowIndCopy(maxRowLength);
-    std::vector<uint8_t> rowDelayCopy(maxRowLength);
-
-    // Loop through rows
-    for(unsigned int i = 0; i < numPre; i++) {
-        // Get pointer to start of row indices
-        unsigned int *rowIndBegin = &ind[i * maxRowLength];
-
-        // Copy row indices into vector
-        // **NOTE** reordering in place is non-trivial
-        std::copy_n(rowIndBegin, rowLength[i], rowIndCopy.begin());
-
-        // Get iterator to end of section of row order to use for this row
-        auto rowOrderEnd = rowOrder.begin();
-        std::advance(rowOrderEnd, rowLength[i]);
-
-        // Fill section with 0, 1, ..., N
-        std::iota(rowOrder.begin(), rowOrderEnd, 0);
-
-        // Sort row order based on postsynaptic indices
-        std::sort(rowOrder.begin(), rowOrderEnd,
-                  [&rowIndCopy](unsigned int a, unsigned int b)
-                  {
-                      return (rowIndCopy[a] < rowIndCopy[b]);
-                  });
-
-        // Use row order to re-order row indices back into original data structure
-        std::transform(rowOrder.cbegin(), rowOrder.cend(), rowIndBegin,
-                       [&rowIndCopy](unsigned int ord){ return rowIndCopy[ord]; });
-
-        // If a delay array is present
-        if(delay) {
-            // Get pointer to start of row delays
-            uint8_t *rowDelayBegin = &(*delay)[i * maxRowLength];
-
-            // Copy row indices into vector
-            // **NOTE** reordering in place is non-trivial
-            std::copy_n(rowDelayBegin, rowLength[i], rowDelayCopy.begin());
-
-            // Use row order to re-order row delays back into original data structure
-            std::transform(rowOrder.cbegin(), rowOrder.cend(), rowDelayBegin,
-                           [&rowDelayCopy](unsigned int ord){ return rowDelayCopy[ord]; });
-        }
+    // Sort a range of rows by postsynaptic index
+    auto sortRows =
+        [&](size_t begin, size_t end)
+        {
+            // Create array of row indices to use for sorting each row
+            std::vector<unsigned int> rowOrder(maxRowLength);
+            std::vector<unsigned int> rowIndCopy(maxRowLength);
+            std::vector<uint8_t> rowDelayCopy(maxRowLength);
+
+            // Loop through rows
+            for(size_t i = begin; i < end; i++) {
+                // Get pointer to start of row indices and creation order
+                unsigned int *rowIndBegin = &ind[i * maxRowLength];
+                const unsigned int *rowOriginalOrder = &originalOrder[i * maxRowLength];
+
+                // Copy row indices into vector
+                // **NOTE** reordering in place is non-trivial
+                std::copy_n(rowIndBegin, rowLength[i], rowIndCopy.begin());
+
+                // Get iterator to end of section of row order to use for this row
+                auto rowOrderEnd = rowOrder.begin();
+                std::advance(rowOrderEnd, rowLength[i]);
+
+                // Fill section with 0, 1, ..., N
+                std::iota(rowOrder.begin(), rowOrderEnd, 0);
+
+                // Sort row order based on postsynaptic indices, using creation order to break ties
+                // **NOTE** this makes order independent of how synapses were scattered into rows
+                std::sort(rowOrder.begin(), rowOrderEnd,
+                          [&rowIndCopy, rowOriginalOrder](unsigned int a, unsigned int b)
+                          {
+                              return (std::tie(rowIndCopy[a], rowOriginalOrder[a]) < std::tie(rowIndCopy[b], rowOriginalOrder[b]));
+                          });
+
+                // Use row order to re-order row indices back into original data structure
+                std::transform(rowOrder.begin(), rowOrderEnd, rowIndBegin,
+                               [&rowIndCopy](unsigned int ord){ return rowIndCopy[ord]; });
+
+                // If a delay array is present
+                if(delay) {
+                    // Get pointer to start of row delays
+                    uint8_t *rowDelayBegin = &(*delay)[i * maxRowLength];
+
+                    // Copy row indices into vector
+                    // **NOTE** reordering in place is non-trivial
+                    std::copy_n(rowDelayBegin, rowLength[i], rowDelayCopy.begin());
+
+                    // Use row order to re-order row delays back into original data structure
+                    std::transform(rowOrder.begin(), rowOrderEnd, rowDelayBegin,
+                                   [&rowDelayCopy](unsigned int ord){ return rowDelayCopy[ord]; });
+                }
 
-        // Loop through synapses in newly reorderd row and set the remap index in the 
-        // synapse's ORIGINAL location to its new index in the ragged array
-        for(unsigned int j = 0; j < rowLength[i]; j++) {
-            remapIndices[originalOrder[(i * maxRowLength) + rowOrder[j]]] = (i * maxRowLength) + j;
-        }
+                // Loop through synapses in newly reorderd row and set the remap index in the
+                // synapse's ORIGINAL location to its new index in the ragged array
+                for(unsigned int j = 0; j < rowLength[i]; j++) {
+                    remapIndices[rowOriginalOrder[rowOrder[j]]] = (unsigned int)((i * maxRowLength) + j);
+                }
+            }
+        };
+
+    // If connectivity was read from a binary file, sort rows in parallel
+    // **NOTE** each row is only touched by one thread and each synapse's remap index is written by one thread
+    if(connectionList) {
+        connectionList->parallelForRows(numPre, sortRows);
+    }
+    else {
+        sortRows(0, numPre);
     }
 }
 }   // anonymous namespace
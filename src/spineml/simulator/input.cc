@@ -1,6 +1,7 @@
 #include "input.h"
 
 // Standard C++ includes
+#include <algorithm>
 #include <limits>
 #include <iostream>
 
@@ -17,6 +18,16 @@
 #include "inputValue.h"
 #include "modelProperty.h"
 
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Number of timesteps spikes can be scheduled ahead before inter-spike interval inputs
+// need to search past them in their calendar queue bucket
+const unsigned long long numCalendarQueueBuckets = 1024;
+}
+
 //----------------------------------------------------------------------------
 // SpineMLSimulator::Input::Base
 //----------------------------------------------------------------------------
@@ -87,7 +98,9 @@ void SpineMLSimulator::Input::SpikeBase::uploadSpikes()
 SpineMLSimulator::Input::InterSpikeIntervalBase::InterSpikeIntervalBase(double dt, const pugi::xml_node &node, std::unique_ptr<InputValue::Base> value,
                                                                         unsigned int popSize, unsigned int *spikeQueuePtr, unsigned int *hostSpikeCount, unsigned int *hostSpikes,
                                                                         PushCurrentSpikesFunc pushCurrentSpikes)
-: SpikeBase(dt, node, std::move(value), popSize, spikeQueuePtr, hostSpikeCount, hostSpikes, pushCurrentSpikes)
+: SpikeBase(dt, node, std::move(value), popSize, spikeQueuePtr, hostSpikeCount, hostSpikes, pushCurrentSpikes),
+  m_ISI(popSize, 0.0), m_TimeToSpike(popSize, 0.0), m_SpikeTimestep(popSize, 0), m_Generation(popSize, 0),
+  m_CalendarQueue(numCalendarQueueBuckets), m_NumAppliedTimesteps(0)
 {
 }
 //----------------------------------------------------------------------------
@@ -98,52 +111,78 @@ void SpineMLSimulator::Input::InterSpikeIntervalBase::apply(double dt, unsigned
     updateValues(dt, timestep,
         [this, dt](unsigned int neuronID, double rate)
         {
-            // If we're turning off spike source, remove it from map
+            // If we're turning off spike source, invalidate any spike scheduled in calendar queue
             if(rate == 0.0) {
-                m_TimeToSpike.erase(neuronID);
+                m_Generation[neuronID]++;
             }
-            // Otherwise
+            // Otherwise, convert rate into interspike interval and schedule first spike
+            // **NOTE** this replaces any spike which was previously scheduled
             else {
-                // Convert rate into interspike interval and calculate time to first spike
-                const double isiMs = 1000.0 / rate;
-                const double tts = getTimeToSpike(isiMs);
-
-                // If this neuron has not had a rate set before, add it to map
-                auto neuronTTS = m_TimeToSpike.find(neuronID);
-                if(neuronTTS == m_TimeToSpike.end()) {
-                    m_TimeToSpike.insert(std::make_pair(neuronID, std::make_pair(isiMs, tts)));
-                }
-                // Otherwise, update it's ISI to the new one and also reset it's time to spike
-                else {
-                    neuronTTS->second.first = isiMs;
-                    neuronTTS->second.second = tts;
-                }
+                m_ISI[neuronID] = 1000.0 / rate;
+                scheduleSpike(neuronID, getTimeToSpike(m_ISI[neuronID]), m_NumAppliedTimesteps, dt);
             }
         });
 
     // If we should be applying input during this timestep
     if(shouldApply(timestep)) {
-        // Loop through all times to spike
-        for(auto &tts : m_TimeToSpike) {
-            // If this neuron should spike this timestep
-            if(tts.second.second <= 0.0) {
-                // Add on time until next spike
-                // **NOTE** this means sub-timestep remainders don't get ignored
-                tts.second.second += getTimeToSpike(tts.second.first);
-
-                // Inject spike
-                injectSpike(tts.first);
+        // Loop through bucket of calendar queue corresponding to this timestep
+        auto &bucket = m_CalendarQueue[m_NumAppliedTimesteps % numCalendarQueueBuckets];
+        m_SpikingNeurons.clear();
+        size_t numRemaining = 0;
+        for(const auto &s : bucket) {
+            // Skip entries for neurons which have since been rescheduled or turned off
+            if(s.second != m_Generation[s.first]) {
+                continue;
             }
 
-            // Decrement time-to-spike
-            tts.second.second -= dt;
+            // If neuron should spike this timestep, add to list
+            if(m_SpikeTimestep[s.first] == m_NumAppliedTimesteps) {
+                m_SpikingNeurons.push_back(s.first);
+            }
+            // Otherwise, neuron is scheduled to spike on a later pass through calendar queue so leave it in bucket
+            else {
+                bucket[numRemaining++] = s;
+            }
         }
+        bucket.resize(numRemaining);
+
+        // Sort spiking neurons so spikes are injected and random numbers drawn in neuron order
+        std::sort(m_SpikingNeurons.begin(), m_SpikingNeurons.end());
+
+        for(unsigned int n : m_SpikingNeurons) {
+            // Add on time until next spike
+            // **NOTE** this means sub-timestep remainders don't get ignored
+            const double timeToSpike = m_TimeToSpike[n] + getTimeToSpike(m_ISI[n]);
+
+            // Inject spike
+            injectSpike(n);
+
+            // Schedule next spike, decrementing time to spike by this timestep
+            scheduleSpike(n, timeToSpike - dt, m_NumAppliedTimesteps + 1, dt);
+        }
+
+        // Advance applied timestep counter
+        m_NumAppliedTimesteps++;
 
         // Upload spikes to GPU if required
         uploadSpikes();
     }
 }
+//----------------------------------------------------------------------------
+void SpineMLSimulator::Input::InterSpikeIntervalBase::scheduleSpike(unsigned int neuronID, double timeToSpike,
+                                                                    unsigned long long timestep, double dt)
+{
+    // Calculate how many timesteps it will take for time to spike to be decremented to zero
+    const unsigned long long numTimesteps = (timeToSpike <= 0.0) ? 0 : (unsigned long long)std::ceil(timeToSpike / dt);
 
+    // Update neuron's spike time and generation
+    m_SpikeTimestep[neuronID] = timestep + numTimesteps;
+    m_TimeToSpike[neuronID] = timeToSpike - ((double)numTimesteps * dt);
+    m_Generation[neuronID]++;
+
+    // Add spike to calendar queue
+    m_CalendarQueue[m_SpikeTimestep[neuronID] % numCalendarQueueBuckets].emplace_back(neuronID, m_Generation[neuronID]);
+}
 
 //----------------------------------------------------------------------------
 // SpineMLSimulator::Input::RegularSpikeRate
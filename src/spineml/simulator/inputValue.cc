@@ -303,7 +303,7 @@ void SpineMLSimulator::InputValue::External::update(double, unsigned long long,
 //----------------------------------------------------------------------------
 // SpineMLSimulator::InputValue::ExternalNetwork
 //----------------------------------------------------------------------------
-SpineMLSimulator::InputValue::ExternalNetwork::ExternalNetwork(double dt, unsigned int numNeurons, const pugi::xml_node &node)
+SpineMLSimulator::InputValue::ExternalNetwork::ExternalNetwork(double dt, unsigned int numNeurons, const pugi::xml_node &node, NetworkIO &networkIO)
 : External(dt, numNeurons, node)
 {
     // Read connection stats
@@ -318,6 +318,9 @@ SpineMLSimulator::InputValue::ExternalNetwork::ExternalNetwork(double dt, unsign
     {
         throw std::runtime_error("Cannot connect network client");
     }
+
+    // Add client to network IO so it can be pipelined
+    networkIO.addClient(m_Client);
 }
 //------------------------------------------------------------------------
 void SpineMLSimulator::InputValue::ExternalNetwork::updateInternal()
@@ -332,7 +335,8 @@ void SpineMLSimulator::InputValue::ExternalNetwork::updateInternal()
 // SpineMLSimulator::InputValue
 //------------------------------------------------------------------------
 std::unique_ptr<SpineMLSimulator::InputValue::Base> SpineMLSimulator::InputValue::create(double dt, unsigned int numNeurons, const pugi::xml_node &node,
-                                                                                         std::map<std::string, InputValue::External*> &externalInputs)
+                                                                                         std::map<std::string, InputValue::External*> &externalInputs,
+                                                                                         NetworkIO &networkIO)
 {
     if(strcmp(node.name(), "ConstantInput") == 0) {
         return std::unique_ptr<Base>(new Constant(dt, numNeurons, node));
@@ -360,7 +364,7 @@ std::unique_ptr<SpineMLSimulator::InputValue::Base> SpineMLSimulator::InputValue
             return inputValue;
         }
         else {
-            return std::unique_ptr<Base>(new ExternalNetwork(dt, numNeurons, node));
+            return std::unique_ptr<Base>(new ExternalNetwork(dt, numNeurons, node, networkIO));
         }
     }
     else {
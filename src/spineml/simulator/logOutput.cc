@@ -4,10 +4,17 @@
 #include <algorithm>
 #include <limits>
 #include <iostream>
+#include <set>
+#include <stdexcept>
 
 // Standard C includes
 #include <cassert>
 #include <cmath>
+#include <cstring>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
 // Filesystem includes
 #include "path.h"
@@ -46,6 +53,37 @@ struct SpineMLTypeName<double>
 // **YUCK** Visual C++ doesn't support constexpr so need to do this the old way
 const char *SpineMLTypeName<float>::name = "float";
 //const char *SpineMLTypeName<double>::name = "double";
+
+// Gaps between logged indices smaller than this are pulled from device rather than starting a new range
+const unsigned int maxPullRangeGap = 64;
+
+// If indices still require more ranges than this, they are pulled from device as a single min/max window
+const size_t maxPullRanges = 16;
+
+// Events are logged as a double precision time followed by a 32-bit neuron index
+const size_t eventBytes = sizeof(double) + sizeof(uint32_t);
+
+void writeEventCSV(std::ostream &os, const char *event)
+{
+    double t;
+    uint32_t index;
+    std::memcpy(&t, event, sizeof(double));
+    std::memcpy(&index, event + sizeof(double), sizeof(uint32_t));
+
+    os << t << "," << index << "\n";
+}
+
+unsigned int countTrailingZeros(uint32_t value)
+{
+    assert(value != 0);
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return (unsigned int)index;
+#else
+    return (unsigned int)__builtin_ctz(value);
+#endif
+}
 }
 
 //----------------------------------------------------------------------------
@@ -91,6 +129,51 @@ SpineMLSimulator::LogOutput::AnalogueBase::AnalogueBase(const pugi::xml_node &no
                                                     std::back_inserter(m_Indices));
 
         LOGD_SPINEML << "\tRecording " << m_Indices.size() << " values";
+
+        // Sort copy of indices
+        std::vector<unsigned int> sortedIndices(m_Indices);
+        std::sort(sortedIndices.begin(), sortedIndices.end());
+
+        // Coalesce indices into ranges, merging those separated by small gaps
+        // **NOTE** ranges are stored as begin and end until they are complete
+        for(unsigned int i : sortedIndices) {
+            if(i >= modelProperty->getSize()) {
+                throw std::runtime_error("Analogue log index " + std::to_string(i) + " out of range");
+            }
+
+            if(m_PullRanges.empty() || (i - m_PullRanges.back().second) >= maxPullRangeGap) {
+                m_PullRanges.emplace_back(i, i + 1);
+            }
+            else {
+                m_PullRanges.back().second = i + 1;
+            }
+        }
+
+        // If there are too many ranges, replace them with a single range from the minimum to the maximum index
+        if(m_PullRanges.size() > maxPullRanges) {
+            m_PullRanges = {std::make_pair(m_PullRanges.front().first, m_PullRanges.back().second)};
+        }
+
+        // Convert ends of ranges to counts
+        for(auto &r : m_PullRanges) {
+            r.second -= r.first;
+        }
+
+        LOGD_SPINEML << "\tPulling " << m_PullRanges.size() << " ranges from device";
+    }
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::LogOutput::AnalogueBase::pullModelPropertyFromDevice() const
+{
+    // If all members of population are being logged or model property can't be pulled in ranges, pull entire model property
+    if(m_PullRanges.empty() || !m_ModelProperty->canPullRangeFromDevice()) {
+        m_ModelProperty->pullFromDevice();
+    }
+    // Otherwise, pull each range covering logged indices
+    else {
+        for(const auto &r : m_PullRanges) {
+            m_ModelProperty->pullRangeFromDevice(r.first, r.second);
+        }
     }
 }
 
@@ -99,9 +182,9 @@ SpineMLSimulator::LogOutput::AnalogueBase::AnalogueBase(const pugi::xml_node &no
 //----------------------------------------------------------------------------
 SpineMLSimulator::LogOutput::AnalogueFile::AnalogueFile(const pugi::xml_node &node, double dt, unsigned long long numTimeSteps,
                                                         const std::string &port, unsigned int popSize,
-                                                        const filesystem::path &logPath,
+                                                        const filesystem::path &logPath, LogWriter &logWriter,
                                                         const ModelProperty::Base *modelProperty)
-    : AnalogueBase(node, dt, modelProperty)
+    : AnalogueBase(node, dt, modelProperty), m_LogWriter(logWriter)
 {
     // If indices are specified, allocate output buffer to match indices
     if(!getIndices().empty()) {
@@ -151,7 +234,7 @@ SpineMLSimulator::LogOutput::AnalogueFile::AnalogueFile(const pugi::xml_node &no
     LOGD_SPINEML << "\tAnalogue file log:" << absoluteFileTitle << "_log.bin";
 
     // Open file for binary writing
-    m_File.open(absoluteFileTitle + "_log.bin", std::ios::binary);
+    m_File = m_LogWriter.openFile(absoluteFileTitle + "_log.bin");
 }
 //----------------------------------------------------------------------------
 void SpineMLSimulator::LogOutput::AnalogueFile::record(double, unsigned long long timestep)
@@ -159,12 +242,11 @@ void SpineMLSimulator::LogOutput::AnalogueFile::record(double, unsigned long lon
     // If we should be recording this timestep
     if(shouldRecord(timestep)) {
         // Pull state variable from device
-        // **TODO** simple min/max index optimisation
         pullModelPropertyFromDevice();
 
         // If no indices are specified, directly write out data from model property
         if(getIndices().empty()) {
-            m_File.write(reinterpret_cast<const char*>(getStateVarBegin()), sizeof(scalar) * getModelPropertySize());
+            m_LogWriter.write(m_File, getStateVarBegin(), sizeof(scalar) * getModelPropertySize());
         }
         // Otherwise
         else {
@@ -176,7 +258,7 @@ void SpineMLSimulator::LogOutput::AnalogueFile::record(double, unsigned long lon
                            });
 
             // Write output buffer to file
-            m_File.write(reinterpret_cast<char*>(m_OutputBuffer.data()), sizeof(scalar) * m_OutputBuffer.size());
+            m_LogWriter.write(m_File, m_OutputBuffer.data(), sizeof(scalar) * m_OutputBuffer.size());
         }
     }
 }
@@ -214,7 +296,6 @@ void SpineMLSimulator::LogOutput::AnalogueExternal::record(double, unsigned long
         // If we should transmit this timestep
         if(m_CurrentIntervalTimesteps == 0) {
             // Pull state variable from device
-            // **TODO** simple min/max index optimisation
             pullModelPropertyFromDevice();
 
             // Perform additional recording logic
@@ -235,7 +316,7 @@ void SpineMLSimulator::LogOutput::AnalogueExternal::record(double, unsigned long
 //----------------------------------------------------------------------------
 SpineMLSimulator::LogOutput::AnalogueNetwork::AnalogueNetwork(const pugi::xml_node &node, double dt,
                                                               const std::string &port, unsigned int popSize,
-                                                              const filesystem::path &logPath,
+                                                              const filesystem::path &logPath, NetworkIO &networkIO,
                                                               const ModelProperty::Base *modelProperty)
     : AnalogueExternal(node, dt, port, popSize, logPath, modelProperty)
 {
@@ -259,6 +340,9 @@ SpineMLSimulator::LogOutput::AnalogueNetwork::AnalogueNetwork(const pugi::xml_no
     {
         throw std::runtime_error("Cannot connect network client");
     }
+
+    // Add client to network IO so it can be pipelined
+    networkIO.addClient(m_Client);
 }
 //----------------------------------------------------------------------------
 void SpineMLSimulator::LogOutput::AnalogueNetwork::recordInternal()
@@ -293,20 +377,38 @@ void SpineMLSimulator::LogOutput::AnalogueNetwork::recordInternal()
 //----------------------------------------------------------------------------
 SpineMLSimulator::LogOutput::Event::Event(const pugi::xml_node &node, double dt, unsigned long long numTimeSteps,
                                           const std::string &port, unsigned int popSize,
-                                          const filesystem::path &logPath, unsigned int *spikeQueuePtr,
-                                          unsigned int *hostSpikeCount, unsigned int *hostSpikes,
-                                          void (*pullCurrentSpikesFunc)(void))
-    : Base(node, dt), m_PopSize(popSize), m_SpikeQueuePtr(spikeQueuePtr),
-      m_HostSpikeCount(hostSpikeCount), m_HostSpikes(hostSpikes), m_PullCurrentSpikesFunc(pullCurrentSpikesFunc)
+                                          const filesystem::path &logPath, LogWriter &logWriter, bool binary,
+                                          unsigned int *spikeQueuePtr, unsigned int *hostSpikeCount, unsigned int *hostSpikes,
+                                          void (*pullCurrentSpikesFunc)(void), uint32_t **recordSpk, unsigned int numRecordingTimesteps)
+    : Base(node, dt), m_LogWriter(logWriter), m_PopSize(popSize), m_SpikeQueuePtr(spikeQueuePtr),
+      m_HostSpikeCount(hostSpikeCount), m_HostSpikes(hostSpikes), m_PullCurrentSpikesFunc(pullCurrentSpikesFunc),
+      m_RecordSpk(recordSpk), m_NumRecordingTimesteps(numRecordingTimesteps), m_RecordingStartTimestep(0),
+      m_IndexMask((popSize + 31) / 32, 0)
 {
     // If indices are specified
-    auto indices = node.attribute("indices");
-    if(indices) {
+    std::set<unsigned int> indices;
+    auto indicesAttr = node.attribute("indices");
+    if(indicesAttr) {
         // Read indices into set
-        SpineMLCommon::SpineMLUtils::readCSVIndices(indices.value(),
-                                                    std::inserter(m_Indices, m_Indices.end()));
+        SpineMLCommon::SpineMLUtils::readCSVIndices(indicesAttr.value(),
+                                                    std::inserter(indices, indices.end()));
 
-        LOGD_SPINEML << "\tRecording " << m_Indices.size() << " values";
+        LOGD_SPINEML << "\tRecording " << indices.size() << " values";
+
+        // Set bits in mask corresponding to indices
+        for(unsigned int i : indices) {
+            if(i >= popSize) {
+                throw std::runtime_error("Event log index " + std::to_string(i) + " out of range");
+            }
+            m_IndexMask[i / 32] |= (1u << (i % 32));
+        }
+    }
+    // Otherwise, set bits in mask corresponding to all neurons
+    else {
+        std::fill(m_IndexMask.begin(), m_IndexMask.end(), 0xFFFFFFFFu);
+        if((popSize % 32) != 0) {
+            m_IndexMask.back() = (1u << (popSize % 32)) - 1;
+        }
     }
 
     // Combine node target and logger names to get file title
@@ -320,13 +422,14 @@ SpineMLSimulator::LogOutput::Event::Event(const pugi::xml_node &node, double dt,
     auto report = reportDoc.append_child("LogReport").append_child("EventLog");
 
     // Write standard report metadata here
-    report.append_child("LogFile").text().set((fileTitle + "_log.csv").c_str());
-    report.append_child("LogFileType").text().set("csv");
+    const std::string logFileExtension = binary ? "_log.bin" : "_log.csv";
+    report.append_child("LogFile").text().set((fileTitle + logFileExtension).c_str());
+    report.append_child("LogFileType").text().set(binary ? "binary" : "csv");
     report.append_child("LogPort").text().set(port.c_str());
     report.append_child("LogEndTime").text().set((double)numTimeSteps * dt);
 
     // If we're logging events from all neurons, add LogAll node to report
-    if(m_Indices.empty()) {
+    if(indices.empty()) {
         auto logAll = report.append_child("LogAll");
         logAll.append_attribute("size").set_value(popSize);
         logAll.append_attribute("type").set_value("int");
@@ -334,18 +437,18 @@ SpineMLSimulator::LogOutput::Event::Event(const pugi::xml_node &node, double dt,
     }
     // Otherwise add LogIndex node for each index
     else {
-        for(unsigned int i : m_Indices) {
+        for(unsigned int i : indices) {
             report.append_child("LogIndex").text().set(i);
         }
     }
 
-    // Add CSV time column
+    // Add time column
     auto logColT = report.append_child("LogCol");
     logColT.append_attribute("heading").set_value("t");
     logColT.append_attribute("dims").set_value("ms");
     logColT.append_attribute("type").set_value("double");
 
-    // Add CSV neuron index column
+    // Add neuron index column
     auto logColIndex = report.append_child("LogCol");
     logColIndex.append_attribute("heading").set_value("index");
     logColIndex.append_attribute("dims").set_value("");
@@ -357,16 +460,27 @@ SpineMLSimulator::LogOutput::Event::Event(const pugi::xml_node &node, double dt,
     // Save report
     reportDoc.save_file((absoluteFileTitle + "_logrep.xml").c_str());
 
-    LOGD_SPINEML << "\tEvent log:" << absoluteFileTitle << ".csv";
+    LOGD_SPINEML << "\tEvent log:" << absoluteFileTitle << logFileExtension;
+    if(m_RecordSpk != nullptr) {
+        LOGD_SPINEML << "\tReading events from GeNN spike recording buffer every " << m_NumRecordingTimesteps << " timesteps";
+    }
 
-    // Open CSV file
-    m_File.open(absoluteFileTitle + "_log.csv");
+    // Open file, formatting events as CSV if binary output isn't required
+    m_File = m_LogWriter.openFile(absoluteFileTitle + logFileExtension, eventBytes,
+                                  binary ? nullptr : writeEventCSV);
 }
 //----------------------------------------------------------------------------
 void SpineMLSimulator::LogOutput::Event::record(double dt, unsigned long long timestep)
 {
-    // If we should be recording this timestep
-    if(shouldRecord(timestep)) {
+    // If events are being read from GeNN spike recording buffer
+    if(m_RecordSpk != nullptr) {
+        // If recording buffer has just been filled (and pulled from device), decode it
+        if(((timestep + 1) % m_NumRecordingTimesteps) == 0) {
+            decodeRecordingBuffer(dt, timestep + 1);
+        }
+    }
+    // Otherwise, if we should be recording this timestep
+    else if(shouldRecord(timestep)) {
         // Determine current spike queue
         const unsigned int spikeQueueIndex = (m_SpikeQueuePtr == nullptr) ? 0 : *m_SpikeQueuePtr;
         const unsigned int spikeOffset = m_PopSize * spikeQueueIndex;
@@ -376,20 +490,67 @@ void SpineMLSimulator::LogOutput::Event::record(double dt, unsigned long long ti
 
         const double t = dt * (double)timestep;
 
-        if(m_Indices.empty()) {
-            for(unsigned int i = 0; i < m_HostSpikeCount[spikeQueueIndex]; i++)
-            {
-                m_File << t << "," << m_HostSpikes[spikeOffset + i] << std::endl;
+        // Build time and index of each event to log in output buffer
+        m_OutputBuffer.resize(eventBytes * m_HostSpikeCount[spikeQueueIndex]);
+        char *event = m_OutputBuffer.data();
+        for(unsigned int i = 0; i < m_HostSpikeCount[spikeQueueIndex]; i++)
+        {
+            const uint32_t spikeID = m_HostSpikes[spikeOffset + i];
+            if(shouldLogIndex(spikeID)) {
+                std::memcpy(event, &t, sizeof(double));
+                std::memcpy(event + sizeof(double), &spikeID, sizeof(uint32_t));
+                event += eventBytes;
             }
         }
-        else {
-            for(unsigned int i = 0; i < m_HostSpikeCount[spikeQueueIndex]; i++)
-            {
-                const unsigned int spikeID = m_HostSpikes[spikeOffset + i];
-                if(m_Indices.find(spikeID) != m_Indices.end()) {
-                    m_File << t << "," << spikeID << std::endl;
-                }
+
+        // Pass events to log writer
+        m_LogWriter.write(m_File, m_OutputBuffer.data(), event - m_OutputBuffer.data());
+    }
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::LogOutput::Event::flush(double dt, unsigned long long timestep)
+{
+    // If there are events in recording buffer which haven't been decoded, decode them
+    if(m_RecordSpk != nullptr && timestep > m_RecordingStartTimestep) {
+        decodeRecordingBuffer(dt, timestep);
+    }
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::LogOutput::Event::decodeRecordingBuffer(double dt, unsigned long long endTimestep)
+{
+    const size_t numWords = m_IndexMask.size();
+
+    // Loop through timesteps in recording buffer which should be recorded
+    m_OutputBuffer.clear();
+    for(unsigned long long timestep = m_RecordingStartTimestep; timestep < endTimestep; timestep++) {
+        if(!shouldRecord(timestep)) {
+            continue;
+        }
+
+        // Get row of recording buffer this timestep was recorded into
+        const uint32_t *row = &(*m_RecordSpk)[(timestep % m_NumRecordingTimesteps) * numWords];
+        const double t = dt * (double)timestep;
+
+        // Loop through words, masking out neurons which shouldn't be logged
+        for(size_t w = 0; w < numWords; w++) {
+            uint32_t word = row[w] & m_IndexMask[w];
+
+            // While there are bits set, find index of lowest, add event and clear it
+            while(word != 0) {
+                const uint32_t spikeID = (uint32_t)(w * 32) + countTrailingZeros(word);
+                word &= (word - 1);
+
+                const size_t offset = m_OutputBuffer.size();
+                m_OutputBuffer.resize(offset + eventBytes);
+                std::memcpy(&m_OutputBuffer[offset], &t, sizeof(double));
+                std::memcpy(&m_OutputBuffer[offset + sizeof(double)], &spikeID, sizeof(uint32_t));
             }
         }
     }
+    m_RecordingStartTimestep = endTimestep;
+
+    // Pass events to log writer
+    if(!m_OutputBuffer.empty()) {
+        m_LogWriter.write(m_File, m_OutputBuffer.data(), m_OutputBuffer.size());
+    }
 }
@@ -0,0 +1,186 @@
+#include "logWriter.h"
+
+// Standard C++ includes
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+// Standard C includes
+#include <cassert>
+#include <cstring>
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+size_t roundUpToPowerOfTwo(size_t value)
+{
+    size_t powerOfTwo = 1;
+    while(powerOfTwo < value) {
+        powerOfTwo <<= 1;
+    }
+    return powerOfTwo;
+}
+}
+
+//----------------------------------------------------------------------------
+// SpineMLSimulator::LogWriter
+//----------------------------------------------------------------------------
+SpineMLSimulator::LogWriter::LogWriter(size_t bufferBytes)
+:   m_Buffer(roundUpToPowerOfTwo(std::max<size_t>(bufferBytes, 64))), m_BufferMask(m_Buffer.size() - 1),
+    m_Head(0), m_Tail(0), m_Stop(false)
+{
+}
+//----------------------------------------------------------------------------
+SpineMLSimulator::LogWriter::~LogWriter()
+{
+    // If writer thread has been started, signal it to stop once it has written remaining data and wait for it
+    if(m_WriterThread.joinable()) {
+        m_Stop.store(true, std::memory_order_release);
+        m_DataAvailable.notify_one();
+        m_WriterThread.join();
+    }
+}
+//----------------------------------------------------------------------------
+unsigned int SpineMLSimulator::LogWriter::openFile(const std::string &filename, size_t itemBytes, FormatFunction format)
+{
+    // Files are only accessed by writer thread once it has started
+    if(m_WriterThread.joinable()) {
+        throw std::runtime_error("Log file '" + filename + "' cannot be opened once logging has begun");
+    }
+
+    // Check a record header and at least one item fit in half of buffer so records can always be written
+    if((sizeof(RecordHeader) + itemBytes) > (m_Buffer.size() / 2)) {
+        throw std::runtime_error("Log writer buffer is too small for log file '" + filename + "'");
+    }
+
+    // Open file (in binary mode unless data is formatted as text)
+    m_Files.emplace_back(new File);
+    auto &file = m_Files.back();
+    file->stream.open(filename, (format == nullptr) ? (std::ios::out | std::ios::binary) : std::ios::out);
+    if(!file->stream.good()) {
+        throw std::runtime_error("Unable to open log file '" + filename + "'");
+    }
+    file->itemBytes = itemBytes;
+    file->format = format;
+    return (unsigned int)(m_Files.size() - 1);
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::LogWriter::write(unsigned int file, const void *data, size_t bytes)
+{
+    assert(file < m_Files.size());
+
+    // Start writer thread when data is first written
+    if(!m_WriterThread.joinable()) {
+        m_WriterThread = std::thread(&LogWriter::writerThreadFunc, this);
+    }
+
+    // Split data into records of whole items which fit in half of buffer
+    const size_t itemBytes = m_Files[file]->itemBytes;
+    assert((bytes % itemBytes) == 0);
+    const size_t maxRecordBytes = (((m_Buffer.size() / 2) - sizeof(RecordHeader)) / itemBytes) * itemBytes;
+
+    const char *dataBytes = reinterpret_cast<const char*>(data);
+    size_t head = m_Head.load(std::memory_order_relaxed);
+    while(bytes > 0) {
+        const size_t recordBytes = std::min(bytes, maxRecordBytes);
+        const size_t totalBytes = sizeof(RecordHeader) + recordBytes;
+
+        // Wait for writer thread to free up enough space for record
+        while((m_Buffer.size() - (head - m_Tail.load(std::memory_order_acquire))) < totalBytes) {
+            std::this_thread::yield();
+        }
+
+        // Copy header and data into buffer
+        const RecordHeader header{file, (uint32_t)recordBytes};
+        copyToBuffer(head, reinterpret_cast<const char*>(&header), sizeof(RecordHeader));
+        copyToBuffer(head + sizeof(RecordHeader), dataBytes, recordBytes);
+
+        // Publish record to writer thread
+        head += totalBytes;
+        m_Head.store(head, std::memory_order_release);
+        m_DataAvailable.notify_one();
+
+        dataBytes += recordBytes;
+        bytes -= recordBytes;
+    }
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::LogWriter::writerThreadFunc()
+{
+    // Scratch space to make items which wrap around end of ring buffer contiguous before formatting
+    size_t maxItemBytes = 0;
+    for(const auto &f : m_Files) {
+        maxItemBytes = std::max(maxItemBytes, f->itemBytes);
+    }
+    std::vector<char> item(maxItemBytes);
+
+    size_t tail = m_Tail.load(std::memory_order_relaxed);
+    while(true) {
+        const size_t head = m_Head.load(std::memory_order_acquire);
+
+        // If buffer is empty
+        if(head == tail) {
+            // If we've been asked to stop, check no more data was written before stopping
+            if(m_Stop.load(std::memory_order_acquire)) {
+                if(m_Head.load(std::memory_order_acquire) == tail) {
+                    break;
+                }
+            }
+            // Otherwise, wait for data
+            // **NOTE** timeout means simulation thread doesn't need to lock mutex when notifying
+            else {
+                std::unique_lock<std::mutex> lock(m_DataAvailableMutex);
+                m_DataAvailable.wait_for(lock, std::chrono::milliseconds(1));
+            }
+            continue;
+        }
+
+        // Loop through available records
+        while(tail != head) {
+            RecordHeader header;
+            copyFromBuffer(tail, reinterpret_cast<char*>(&header), sizeof(RecordHeader));
+            tail += sizeof(RecordHeader);
+
+            File &file = *m_Files[header.file];
+
+            // If file is binary, write data directly from buffer in (at most) two sections
+            if(file.format == nullptr) {
+                const size_t start = tail & m_BufferMask;
+                const size_t firstBytes = std::min<size_t>(header.bytes, m_Buffer.size() - start);
+                file.stream.write(&m_Buffer[start], firstBytes);
+                if(firstBytes < header.bytes) {
+                    file.stream.write(&m_Buffer[0], header.bytes - firstBytes);
+                }
+            }
+            // Otherwise, format each item
+            else {
+                for(size_t i = 0; i < header.bytes; i += file.itemBytes) {
+                    copyFromBuffer(tail + i, item.data(), file.itemBytes);
+                    file.format(file.stream, item.data());
+                }
+            }
+
+            // Free space used by record
+            tail += header.bytes;
+            m_Tail.store(tail, std::memory_order_release);
+        }
+    }
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::LogWriter::copyToBuffer(size_t position, const char *data, size_t bytes)
+{
+    const size_t start = position & m_BufferMask;
+    const size_t firstBytes = std::min(bytes, m_Buffer.size() - start);
+    std::memcpy(&m_Buffer[start], data, firstBytes);
+    std::memcpy(&m_Buffer[0], data + firstBytes, bytes - firstBytes);
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::LogWriter::copyFromBuffer(size_t position, char *data, size_t bytes) const
+{
+    const size_t start = position & m_BufferMask;
+    const size_t firstBytes = std::min(bytes, m_Buffer.size() - start);
+    std::memcpy(data, &m_Buffer[start], firstBytes);
+    std::memcpy(data + firstBytes, &m_Buffer[0], bytes - firstBytes);
+}
@@ -1,22 +1,36 @@
 #include "networkClient.h"
 
 // Standard C++ includes
+#include <algorithm>
 #include <stdexcept>
+#include <thread>
 
 // Standard C includes
+#include <cerrno>
 #include <cstring>
 
+#ifndef _WIN32
+// POSIX C includes
+extern "C"
+{
+#include <fcntl.h>
+}
+#endif
+
 // SpineML common includes
 #include "spineMLLogging.h"
 
 //----------------------------------------------------------------------------
 // SpineMLSimulator::NetworkClient
 //----------------------------------------------------------------------------
-SpineMLSimulator::NetworkClient::NetworkClient() : m_Socket(-1)
+SpineMLSimulator::NetworkClient::NetworkClient()
+:   m_Socket(-1), m_Mode(Mode::Source), m_Size(0), m_PipelineHead(0), m_PipelineTail(0), m_PipelineError(false),
+    m_PipelineState(PipelineState::Data), m_PipelineBytes(0)
 {
 }
 //----------------------------------------------------------------------------
 SpineMLSimulator::NetworkClient::NetworkClient(const std::string &hostname, unsigned int port, unsigned int size, DataType dataType, Mode mode, const std::string &connectionName)
+:   NetworkClient()
 {
     if(!connect(hostname, port, size, dataType, mode, connectionName)) {
         throw std::runtime_error("Cannot connect network client");
@@ -37,6 +51,10 @@ SpineMLSimulator::NetworkClient::~NetworkClient()
 //----------------------------------------------------------------------------
 bool SpineMLSimulator::NetworkClient::connect(const std::string &hostname, unsigned int port, unsigned int size, DataType dataType, Mode mode, const std::string &connectionName)
 {
+    m_Mode = mode;
+    m_ConnectionName = connectionName;
+    m_Size = size;
+
     // Create socket
     m_Socket = socket(AF_INET, SOCK_STREAM, 0);
     if(m_Socket < 0) {
@@ -115,6 +133,25 @@ bool SpineMLSimulator::NetworkClient::connect(const std::string &hostname, unsig
 //----------------------------------------------------------------------------
 bool SpineMLSimulator::NetworkClient::receive(std::vector<double> &buffer)
 {
+    // If client is pipelined
+    if(isPipelined()) {
+        // Wait for NetworkIO thread to receive a buffer
+        const size_t tail = m_PipelineTail.load(std::memory_order_relaxed);
+        while(m_PipelineHead.load(std::memory_order_acquire) == tail) {
+            if(m_PipelineError.load(std::memory_order_acquire)) {
+                LOGE_SPINEML << m_PipelineErrorMessage;
+                return false;
+            }
+            std::this_thread::yield();
+        }
+
+        // Copy buffer and return it to NetworkIO thread
+        const auto &pipelineBuffer = m_PipelineBuffers[tail % m_PipelineBuffers.size()];
+        std::copy(pipelineBuffer.cbegin(), pipelineBuffer.cend(), buffer.begin());
+        m_PipelineTail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
     // Get buffer size and write pointer as bytes
     const int bufferSizeBytes = buffer.size() * sizeof(double);
     char *bufferBytes = reinterpret_cast<char*>(buffer.data());
@@ -122,7 +159,7 @@ bool SpineMLSimulator::NetworkClient::receive(std::vector<double> &buffer)
     // get data
     int totalReceivedBytes = 0;
     while (totalReceivedBytes < bufferSizeBytes) {
-        const int receivedBytes = ::recv(m_Socket, bufferBytes + totalReceivedBytes, bufferSizeBytes, MSG_WAITALL);
+        const int receivedBytes = ::recv(m_Socket, bufferBytes + totalReceivedBytes, bufferSizeBytes - totalReceivedBytes, MSG_WAITALL);
         if(receivedBytes < 1) {
             LOGE_SPINEML << "Error reading from socket";
             return false;
@@ -149,6 +186,31 @@ bool SpineMLSimulator::NetworkClient::receive(std::vector<double> &buffer)
 //----------------------------------------------------------------------------
 bool SpineMLSimulator::NetworkClient::send(const std::vector<double> &buffer)
 {
+    // If client is pipelined
+    if(isPipelined()) {
+        // Wait for NetworkIO thread to free up a buffer
+        const size_t head = m_PipelineHead.load(std::memory_order_relaxed);
+        while((head - m_PipelineTail.load(std::memory_order_acquire)) == m_PipelineBuffers.size()) {
+            if(m_PipelineError.load(std::memory_order_acquire)) {
+                LOGE_SPINEML << m_PipelineErrorMessage;
+                return false;
+            }
+            std::this_thread::yield();
+        }
+
+        // If an earlier send has failed, give error
+        if(m_PipelineError.load(std::memory_order_acquire)) {
+            LOGE_SPINEML << m_PipelineErrorMessage;
+            return false;
+        }
+
+        // Copy data into buffer and publish to NetworkIO thread
+        auto &pipelineBuffer = m_PipelineBuffers[head % m_PipelineBuffers.size()];
+        std::copy(buffer.cbegin(), buffer.cend(), pipelineBuffer.begin());
+        m_PipelineHead.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
     // Start non-blocking send mode and get flags for send (if any)
     const int sendFlags = startNonBlockingSend();
 
@@ -159,7 +221,7 @@ bool SpineMLSimulator::NetworkClient::send(const std::vector<double> &buffer)
     // send data
     int totalSentBytes = 0;
     while (totalSentBytes < bufferSizeBytes) {
-        const int sentBytes = ::send(m_Socket, bufferBytes + totalSentBytes, bufferSizeBytes, sendFlags);
+        const int sentBytes = ::send(m_Socket, bufferBytes + totalSentBytes, bufferSizeBytes - totalSentBytes, sendFlags);
         if(sentBytes < 1) {
             LOGE_SPINEML << "Error writing to socket";
             return false;
@@ -218,3 +280,188 @@ bool SpineMLSimulator::NetworkClient::sendRequestReadResponse(const std::string
 
     return true;
 }
+//----------------------------------------------------------------------------
+void SpineMLSimulator::NetworkClient::enablePipelining(unsigned int lookahead)
+{
+    // Allocate ring of buffers
+    // **NOTE** the network protocol always uses double precision
+    m_PipelineBuffers.assign(lookahead, std::vector<double>(m_Size));
+
+    // Put socket into non-blocking mode
+#ifdef _WIN32
+    u_long nonBlockingMode = 1;
+    if(ioctlsocket(m_Socket, FIONBIO, &nonBlockingMode) != 0) {
+#else
+    if(fcntl(m_Socket, F_SETFL, fcntl(m_Socket, F_GETFL, 0) | O_NONBLOCK) < 0) {
+#endif
+        throw std::runtime_error("Unable to make socket for '" + m_ConnectionName + "' non-blocking");
+    }
+
+    LOGD_SPINEML << "\tPipelining network connection '" << m_ConnectionName << "' with " << lookahead << " buffer lookahead";
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::NetworkClient::getPollEvents(pollfd &pollFD) const
+{
+    pollFD.fd = m_Socket;
+    pollFD.events = 0;
+    pollFD.revents = 0;
+
+    // If connection has failed, ignore
+    if(m_PipelineError.load(std::memory_order_relaxed)) {
+        pollFD.fd = -1;
+    }
+    // Otherwise, if we're receiving data
+    else if(m_Mode == Mode::Target) {
+        // If we're waiting to send response, wait for socket to be writable
+        if(m_PipelineState == PipelineState::Response) {
+            pollFD.events = POLLOUT;
+        }
+        // Otherwise, if simulation has freed up a buffer, wait for data
+        else if((m_PipelineHead.load(std::memory_order_relaxed) - m_PipelineTail.load(std::memory_order_acquire)) < m_PipelineBuffers.size()) {
+            pollFD.events = POLLIN;
+        }
+    }
+    // Otherwise, we're sending data
+    else {
+        // If we're waiting for response, wait for data
+        if(m_PipelineState == PipelineState::Response) {
+            pollFD.events = POLLIN;
+        }
+        // Otherwise, if simulation has provided a buffer, wait for socket to be writable
+        else if(m_PipelineHead.load(std::memory_order_acquire) != m_PipelineTail.load(std::memory_order_relaxed)) {
+            pollFD.events = POLLOUT;
+        }
+    }
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::NetworkClient::processPollEvents(short revents)
+{
+    if(revents == 0 || m_PipelineError.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    const size_t bufferBytes = m_PipelineBuffers.front().size() * sizeof(double);
+    if(m_Mode == Mode::Target) {
+        // Receive as much of buffer as possible
+        if(m_PipelineState == PipelineState::Data) {
+            const size_t head = m_PipelineHead.load(std::memory_order_relaxed);
+            char *data = reinterpret_cast<char*>(m_PipelineBuffers[head % m_PipelineBuffers.size()].data());
+            const int receivedBytes = receiveNonBlocking(data + m_PipelineBytes, bufferBytes - m_PipelineBytes);
+            if(receivedBytes < 0) {
+                setPipelineError("Error reading from socket");
+                return;
+            }
+            m_PipelineBytes += receivedBytes;
+
+            // If buffer is complete, publish it to simulation and start sending response
+            if(m_PipelineBytes == bufferBytes) {
+                m_PipelineHead.store(head + 1, std::memory_order_release);
+                m_PipelineBytes = 0;
+                m_PipelineState = PipelineState::Response;
+            }
+        }
+
+        // If response is required, try and send it
+        if(m_PipelineState == PipelineState::Response) {
+            const Response response = Response::Received;
+            const int sentBytes = sendNonBlocking(reinterpret_cast<const char*>(&response), sizeof(Response));
+            if(sentBytes < 0) {
+                setPipelineError("Error writing to socket");
+            }
+            else if(sentBytes > 0) {
+                m_PipelineState = PipelineState::Data;
+            }
+        }
+    }
+    else {
+        // Send as much of buffer as possible
+        if(m_PipelineState == PipelineState::Data) {
+            const size_t tail = m_PipelineTail.load(std::memory_order_relaxed);
+            const char *data = reinterpret_cast<const char*>(m_PipelineBuffers[tail % m_PipelineBuffers.size()].data());
+            const int sentBytes = sendNonBlocking(data + m_PipelineBytes, bufferBytes - m_PipelineBytes);
+            if(sentBytes < 0) {
+                setPipelineError("Error writing to socket");
+                return;
+            }
+            m_PipelineBytes += sentBytes;
+
+            // If buffer is complete, start waiting for response
+            if(m_PipelineBytes == bufferBytes) {
+                m_PipelineBytes = 0;
+                m_PipelineState = PipelineState::Response;
+            }
+        }
+        // Otherwise, try and read response
+        else {
+            Response response;
+            const int receivedBytes = receiveNonBlocking(reinterpret_cast<char*>(&response), sizeof(Response));
+            if(receivedBytes < 0) {
+                setPipelineError("Unable to receive response");
+            }
+            else if(receivedBytes > 0) {
+                if(response == Response::Abort) {
+                    setPipelineError("Remote host aborted");
+                }
+                // Otherwise, return buffer to simulation
+                else {
+                    m_PipelineTail.store(m_PipelineTail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+                    m_PipelineState = PipelineState::Data;
+                }
+            }
+        }
+    }
+}
+//----------------------------------------------------------------------------
+bool SpineMLSimulator::NetworkClient::isIdle() const
+{
+    // Clients receiving data and those which have failed never need to finish transfers
+    if(m_Mode == Mode::Target || m_PipelineError.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    // Otherwise, client is idle once all buffers sent by the simulation have been received
+    else {
+        return (m_PipelineHead.load(std::memory_order_acquire) == m_PipelineTail.load(std::memory_order_relaxed));
+    }
+}
+//----------------------------------------------------------------------------
+int SpineMLSimulator::NetworkClient::receiveNonBlocking(char *data, size_t bytes)
+{
+    const int receivedBytes = ::recv(m_Socket, data, (int)bytes, 0);
+    if(receivedBytes > 0) {
+        return receivedBytes;
+    }
+    // Remote host has closed connection
+    else if(receivedBytes == 0) {
+        return -1;
+    }
+    else {
+#ifdef _WIN32
+        return (WSAGetLastError() == WSAEWOULDBLOCK) ? 0 : -1;
+#else
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+#endif
+    }
+}
+//----------------------------------------------------------------------------
+int SpineMLSimulator::NetworkClient::sendNonBlocking(const char *data, size_t bytes)
+{
+    const int sentBytes = ::send(m_Socket, data, (int)bytes, 0);
+    if(sentBytes >= 0) {
+        return sentBytes;
+    }
+    else {
+#ifdef _WIN32
+        return (WSAGetLastError() == WSAEWOULDBLOCK) ? 0 : -1;
+#else
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+#endif
+    }
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::NetworkClient::setPipelineError(const std::string &message)
+{
+    // **NOTE** a target's connection closing is only an error if the simulation tries to receive more data so just store message
+    LOGD_SPINEML << "Network connection '" << m_ConnectionName << "' stopped:" << message;
+    m_PipelineErrorMessage = message;
+    m_PipelineError.store(true, std::memory_order_release);
+}
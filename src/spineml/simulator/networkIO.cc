@@ -0,0 +1,93 @@
+#include "networkIO.h"
+
+// Standard C++ includes
+#include <stdexcept>
+
+// Standard C includes
+#include <cerrno>
+
+// SpineML common includes
+#include "spineMLLogging.h"
+
+// SpineML simulator includes
+#include "networkClient.h"
+
+//----------------------------------------------------------------------------
+// SpineMLSimulator::NetworkIO
+//----------------------------------------------------------------------------
+SpineMLSimulator::NetworkIO::NetworkIO() : m_Stop(false)
+{
+}
+//----------------------------------------------------------------------------
+SpineMLSimulator::NetworkIO::~NetworkIO()
+{
+    // If IO thread has been started, signal it to stop once it has sent remaining data and wait for it
+    if(m_IOThread.joinable()) {
+        m_Stop.store(true, std::memory_order_release);
+        m_IOThread.join();
+    }
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::NetworkIO::addClient(NetworkClient &client)
+{
+    if(m_IOThread.joinable()) {
+        throw std::runtime_error("Network clients cannot be added once network IO has started");
+    }
+
+    m_Clients.push_back(&client);
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::NetworkIO::start(unsigned int lookahead)
+{
+    // If pipelining is enabled and there are any clients
+    if(lookahead > 0 && !m_Clients.empty()) {
+        // Switch clients to pipelined mode
+        for(auto *c : m_Clients) {
+            c->enablePipelining(lookahead);
+        }
+
+        // Start IO thread
+        LOGD_SPINEML << "Starting network IO thread for " << m_Clients.size() << " connections";
+        m_IOThread = std::thread(&NetworkIO::ioThreadFunc, this);
+    }
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::NetworkIO::ioThreadFunc()
+{
+    std::vector<pollfd> pollFDs(m_Clients.size());
+    while(true) {
+        // Get events each client is waiting for and determine whether all data sent by simulation has been transferred
+        bool idle = true;
+        for(size_t i = 0; i < m_Clients.size(); i++) {
+            m_Clients[i]->getPollEvents(pollFDs[i]);
+            idle = idle && m_Clients[i]->isIdle();
+        }
+
+        // If we've been asked to stop and all data has been sent, stop
+        if(idle && m_Stop.load(std::memory_order_acquire)) {
+            break;
+        }
+
+        // Wait for sockets to become ready
+        // **NOTE** timeout means simulation thread doesn't need to wake IO thread when it fills or frees buffers
+#ifdef _WIN32
+        const int numReady = WSAPoll(pollFDs.data(), (ULONG)pollFDs.size(), 1);
+#else
+        const int numReady = poll(pollFDs.data(), pollFDs.size(), 1);
+        if(numReady < 0 && errno == EINTR) {
+            continue;
+        }
+#endif
+        if(numReady < 0) {
+            LOGE_SPINEML << "Error polling network sockets";
+            break;
+        }
+
+        // Transfer data on ready sockets
+        if(numReady > 0) {
+            for(size_t i = 0; i < m_Clients.size(); i++) {
+                m_Clients[i]->processPollEvents(pollFDs[i].revents);
+            }
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #include "simulator.h"
 
 // Standard C++ includes
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -49,6 +50,16 @@ extern "C"
 
 using namespace SpineMLCommon;
 
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Maximum number of timesteps of spikes GeNN's recording buffers are sized to hold
+// **NOTE** buffers are pulled and decoded whenever they fill up
+const unsigned long long maxRecordingTimesteps = 10000;
+}
+
 //----------------------------------------------------------------------------
 // SpineMLSimulator::Simulator
 //----------------------------------------------------------------------------
@@ -56,19 +67,28 @@ namespace SpineMLSimulator
 {
 Simulator::Simulator(plog::Severity logLevel)
 :   m_ModelLibrary(nullptr), m_StepTime(nullptr), m_SimulationTime(nullptr), m_SimulationTimestep(nullptr),
-    m_DT(0.0), m_DurationMs(0.0), m_InputMs(0.0), m_SimulateMs(0.0), m_LogMs(0.0)
+    m_PullRecordingBuffers(nullptr), m_NumRecordingTimesteps(0), m_DT(0.0), m_DurationMs(0.0), m_InputMs(0.0), m_SimulateMs(0.0), m_LogMs(0.0)
 {
     SpineMLLogging::init(logLevel, &m_ConsoleAppender);
 }
 //----------------------------------------------------------------------------
-Simulator::Simulator(const std::string &experimentXML, const std::string &overrideOutputPath, plog::Severity logLevel)
+Simulator::Simulator(const std::string &experimentXML, const std::string &overrideOutputPath, plog::Severity logLevel,
+                     bool binaryEventLogs, unsigned int networkLookahead)
 : Simulator(logLevel)
 {
-    load(experimentXML, overrideOutputPath);
+    load(experimentXML, overrideOutputPath, binaryEventLogs, networkLookahead);
 }
 //----------------------------------------------------------------------------
 Simulator::~Simulator()
 {
+    // If simulation has ended part way through filling spike recording buffers, pull them and log remaining events
+    if(m_PullRecordingBuffers != nullptr && (*m_SimulationTimestep % m_NumRecordingTimesteps) != 0) {
+        m_PullRecordingBuffers();
+        for(auto &logger : m_Loggers) {
+            logger->flush(getDT(), *m_SimulationTimestep);
+        }
+    }
+
      // Close model library if loaded successfully
     if(m_ModelLibrary) {
 #ifdef _WIN32
@@ -79,7 +99,8 @@ Simulator::~Simulator()
     }
 }
 //----------------------------------------------------------------------------
-void Simulator::load(const std::string &experimentXML, const std::string &overrideOutputPath)
+void Simulator::load(const std::string &experimentXML, const std::string &overrideOutputPath, bool binaryEventLogs,
+                     unsigned int networkLookahead)
 {
     // Use filesystem library to get parent path of the network XML file
     const auto experimentPath = filesystem::path(experimentXML).make_absolute();
@@ -315,15 +336,29 @@ void Simulator::load(const std::string &experimentXML, const std::string &overri
     const auto logPath = outputPath / "log";
     filesystem::create_directory(logPath);
 
+    // If model uses GeNN's spike recording system, allocate recording buffers
+    // **NOTE** this must happen before loggers are created so they can check for recording buffers
+    auto allocateRecordingBuffers = (void (*)(unsigned int))getLibrarySymbol("allocateRecordingBuffers", true);
+    if(allocateRecordingBuffers != nullptr) {
+        m_NumRecordingTimesteps = (unsigned int)std::max(1ull, std::min(calcNumTimesteps(), maxRecordingTimesteps));
+        allocateRecordingBuffers(m_NumRecordingTimesteps);
+        m_PullRecordingBuffers = (VoidFunction)getLibrarySymbol("pullRecordingBuffersFromDevice");
+
+        LOGD_SPINEML << "Allocated spike recording buffers for " << m_NumRecordingTimesteps << " timesteps";
+    }
+
     // Loop through output loggers specified by experiment and create handler
     for(auto logOutput : experiment.children("LogOutput")) {
-        m_Loggers.push_back(createLogOutput(logOutput, logPath, componentSizes, componentURLs, componentEventPorts));
+        m_Loggers.push_back(createLogOutput(logOutput, logPath, binaryEventLogs, componentSizes, componentURLs, componentEventPorts));
     }
 
     // Loop through inputs specified by experiment and create handlers
     for(auto input : experiment.select_nodes(SpineMLUtils::xPathNodeHasSuffix("Input").c_str())) {
         m_Inputs.push_back(createInput(input.node(), componentSizes, componentURLs, componentEventPorts));
     }
+
+    // Start pipelining any network connections created by loggers and inputs
+    m_NetworkIO.start(networkLookahead);
 }
 //----------------------------------------------------------------------------
 void Simulator::stepTime()
@@ -346,6 +381,12 @@ void Simulator::stepTime()
         m_StepTime();
     }
 
+    // If spike recording buffers have just been filled, pull them from device
+    if(m_PullRecordingBuffers != nullptr && ((i + 1) % m_NumRecordingTimesteps) == 0) {
+        TimerAccumulate t(m_LogMs);
+        m_PullRecordingBuffers();
+    }
+
     // If this is the first timestep
     if(i == 0) {
         // Calculate difference between the time elapsed according to GeNN's internal counter and our desired tiemstep
@@ -583,7 +624,7 @@ std::unique_ptr<Input::Base> Simulator::createInput(const pugi::xml_node &node,
 
     // Create suitable input value
     std::unique_ptr<InputValue::Base> inputValue = InputValue::create(m_DT, targetSize->second, node,
-                                                                      m_ExternalInputs);
+                                                                      m_ExternalInputs, m_NetworkIO);
 
     // If target is an event receive port
     std::string port = node.attribute("port").value();
@@ -646,7 +687,7 @@ std::unique_ptr<Input::Base> Simulator::createInput(const pugi::xml_node &node,
 }
 //----------------------------------------------------------------------------
 std::unique_ptr<LogOutput::Base> Simulator::createLogOutput(const pugi::xml_node &node,
-                                                            const filesystem::path &logPath,
+                                                            const filesystem::path &logPath, bool binaryEventLogs,
                                                             const std::map<std::string, unsigned int> &componentSizes,
                                                             const std::map<std::string, std::string> &componentURLs,
                                                             const ComponentEventPorts &componentEventPorts)
@@ -679,10 +720,19 @@ std::unique_ptr<LogOutput::Base> Simulator::createLogOutput(const pugi::xml_node
         VoidFunction pullFunc;
         std::tie(hostSpikeCount, hostSpikes, spikeQueuePtr, pushFunc, pullFunc) = getNeuronPopSpikeVars(SpineMLUtils::getSafeName(target));
 
+        // If spike recording buffers are allocated and target isn't a spike source (into which spikes are injected from the host),
+        // get spike recording buffer for population (nullptr if recording isn't enabled for it)
+        uint32_t **recordSpk = nullptr;
+        auto targetURL = componentURLs.find(target);
+        if(m_PullRecordingBuffers != nullptr && (targetURL == componentURLs.end() || targetURL->second != "SpikeSource")) {
+            recordSpk = (uint32_t**)getLibrarySymbol(("recordSpk" + SpineMLUtils::getSafeName(target)).c_str(), true);
+        }
+
         // Create event logger
         return std::unique_ptr<LogOutput::Base>(new LogOutput::Event(node, getDT(), numTimeSteps, port, targetSize->second,
-                                                                     logPath, spikeQueuePtr,
-                                                                     hostSpikeCount, hostSpikes, pullFunc));
+                                                                     logPath, m_LogWriter, binaryEventLogs, spikeQueuePtr,
+                                                                     hostSpikeCount, hostSpikes, pullFunc,
+                                                                     recordSpk, m_NumRecordingTimesteps));
     }
     // Otherwise we assume it's an analogue send port
     else {
@@ -694,7 +744,7 @@ std::unique_ptr<LogOutput::Base> Simulator::createLogOutput(const pugi::xml_node
             if(portProperty != targetProperties->second.end()) {
                 if(shouldLogToFile) {
                     return std::unique_ptr<LogOutput::Base>(new LogOutput::AnalogueFile(node, getDT(), numTimeSteps, port, targetSize->second,
-                                                                                        logPath, portProperty->second.get()));
+                                                                                        logPath, m_LogWriter, portProperty->second.get()));
                 }
                 else if(hostName == "0.0.0.0") {
                     // Create logger
@@ -713,7 +763,7 @@ std::unique_ptr<LogOutput::Base> Simulator::createLogOutput(const pugi::xml_node
                 }
                 else {
                     return std::unique_ptr<LogOutput::Base>(new LogOutput::AnalogueNetwork(node, getDT(), port, targetSize->second,
-                                                                                           logPath, portProperty->second.get()));
+                                                                                           logPath, m_NetworkIO, portProperty->second.get()));
                 }
             }
             else {
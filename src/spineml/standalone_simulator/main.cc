@@ -15,10 +15,14 @@ int main(int argc, char *argv[])
         std::string experimentFilename;
         std::string outputDirectory;
         unsigned int logLevel = plog::info;
+        bool binaryEventLogs = false;
+        unsigned int networkLookahead = 0;
 
         app.add_option("experiment,-e,--experiment", experimentFilename, "Experiment xml file")->required();
         app.add_option("output,-o,--output", outputDirectory, "Output directory for generated code");
         app.add_flag("--log-error{2},--log-warning{3},--log-info{4},--log-debug{5}", logLevel, "Verbosity of logging to show");
+        app.add_flag("--binary-event-logs", binaryEventLogs, "Write event logs in binary rather than CSV format");
+        app.add_option("--network-lookahead", networkLookahead, "Number of buffers network inputs and logs can be transferred ahead of simulation on a separate thread (0 transfers synchronously)");
 
         CLI11_PARSE(app, argc, argv);
 
@@ -32,7 +36,7 @@ int main(int argc, char *argv[])
 #endif  // _WIN32
 
         // Create simulator
-        Simulator simulator(experimentFilename, outputDirectory, (plog::Severity)logLevel);
+        Simulator simulator(experimentFilename, outputDirectory, (plog::Severity)logLevel, binaryEventLogs, networkLookahead);
 
         const unsigned long long numTimeSteps = simulator.calcNumTimesteps();
         LOGI_SPINEML << "Simulating for " << numTimeSteps << " " << simulator.getDT() << "ms timesteps";
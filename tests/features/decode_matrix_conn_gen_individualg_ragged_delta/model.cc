@@ -0,0 +1,112 @@
+//--------------------------------------------------------------------------
+/*! \file decode_matrix_conn_gen_individualg_ragged_delta/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Decoder
+//----------------------------------------------------------------------------
+// **NOTE** postsynaptic neurons representing each bit are spread out so
+// the deltas between them require one, two or three bytes to encode
+class Decoder : public InitSparseConnectivitySnippet::Base
+{
+public:
+    DECLARE_SNIPPET(Decoder, 0);
+
+    SET_ROW_BUILD_CODE(
+        "if(j < 4) {\n"
+        "   const unsigned int jValue = (1 << j);\n"
+        "   if((($(id_pre) + 1) & jValue) != 0)\n"
+        "   {\n"
+        "       const unsigned int postInd = (j == 0) ? 0 : ((j == 1) ? 100 : ((j == 2) ? 10000 : 60000));\n"
+        "       $(addSynapse, postInd);\n"
+        "   }\n"
+        "}\n"
+        "else {\n"
+        "   $(endRow);\n"
+        "}\n"
+        "j++;\n");
+    SET_ROW_BUILD_STATE_VARS({{"j", "unsigned int", 0}});
+
+    SET_CALC_MAX_ROW_LENGTH_FUNC(
+        [](unsigned int, unsigned int, const std::vector<double>&)
+        {
+            return 4;
+        });
+};
+IMPLEMENT_SNIPPET(Decoder);
+
+//----------------------------------------------------------------------------
+// PostInd
+//----------------------------------------------------------------------------
+class PostInd : public InitVarSnippet::Base
+{
+public:
+    DECLARE_SNIPPET(PostInd, 0);
+
+    SET_CODE("$(value) = $(id_post) + 1;\n");
+};
+IMPLEMENT_SNIPPET(PostInd);
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(ModelSpec &model)
+{
+#ifdef CL_HPP_TARGET_OPENCL_VERSION
+    if(std::getenv("OPENCL_DEVICE") != nullptr) {
+        GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
+        GENN_PREFERENCES.manualDeviceID = std::atoi(std::getenv("OPENCL_DEVICE"));
+    }
+    if(std::getenv("OPENCL_PLATFORM") != nullptr) {
+        GENN_PREFERENCES.manualPlatformID = std::atoi(std::getenv("OPENCL_PLATFORM"));
+    }
+#endif
+    model.setDT(0.1);
+    model.setName("decode_matrix_conn_gen_individualg_ragged_delta");
+
+    // Static synapse parameters
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(initVar<PostInd>());    // 0 - Wij (nA)
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 10, {}, {});
+    model.addNeuronPopulation<Neuron>("Post", 60001, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PostGather", 60001, {}, Neuron::VarValues(0.0));
+
+    // Scatter input along delta-encoded rows
+    auto *syn = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<Decoder>({}));
+    syn->setDeltaEncodedSparseIndEnabled(true);
+
+    // Gather input using postsynaptic remapping built from delta-encoded rows
+    auto *synGather = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynGather", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "PostGather",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<Decoder>({}));
+    synGather->setDeltaEncodedSparseIndEnabled(true);
+    synGather->setPostsynapticGatherEnabled(true);
+
+    model.setPrecision(GENN_FLOAT);
+}
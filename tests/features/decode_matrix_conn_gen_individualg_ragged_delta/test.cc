@@ -0,0 +1,88 @@
+//--------------------------------------------------------------------------
+/*! \file decode_matrix_conn_gen_individualg_ragged_delta/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Standard C includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "decode_matrix_conn_gen_individualg_ragged_delta_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    bool Simulate()
+    {
+        // Indices of postsynaptic neurons representing each bit
+        const unsigned int postInd[4] = {0, 100, 10000, 60000};
+
+        for (int i = 0; i < (int)(10.0f / DT); i++) {
+            // What value should neurons be representing this time step?
+            const unsigned int in_value = (i / 10) + 1;
+
+            // Input spike representing value
+            // **NOTE** neurons start from zero
+            glbSpkCntPre[0] = 1;
+            glbSpkPre[0] = (in_value - 1);
+
+            // Push spikes to device
+            pushPreSpikesToDevice();
+
+            // Step GeNN
+            StepGeNN();
+
+            // Loop through output neurons
+            unsigned int out_value = 0;
+            unsigned int out_value_gather = 0;
+            for(unsigned int j = 0; j < 4; j++) {
+                // If this neuron is representing 1 add value it represents to output
+                // **NOTE** weights are initialised to postsynaptic index + 1
+                const float weight = (float)(postInd[j] + 1);
+                if(std::fabs(xPost[postInd[j]] - weight) < 1E-5) {
+                    out_value += (1 << j);
+                }
+                if(std::fabs(xPostGather[postInd[j]] - weight) < 1E-5) {
+                    out_value_gather += (1 << j);
+                }
+            }
+
+            // If input value isn't correctly decoded, return false
+            if(out_value != in_value || out_value_gather != in_value) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+    }
+};
+
+TEST_F(SimTest, DecodeMatrixConnGenIndividualgRaggedDelta)
+{
+    // Check total error is less than some tolerance
+    EXPECT_TRUE(Simulate());
+}
@@ -0,0 +1,41 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_rng_counter_based/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 2);
+
+    SET_SIM_CODE("$(x)= $(gennrand_uniform);\n");
+
+    SET_VARS({{"x", "scalar"}, {"y", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    // Generate random numbers using counter-based RNG streams unique to each neuron and timestep
+    // **NOTE** this preference is only supported by CPU backends
+    GENN_PREFERENCES.enableCounterBasedRNG = true;
+
+    model.setDT(0.1);
+    model.setName("neuron_rng_counter_based");
+
+    InitVarSnippet::Uniform::ParamValues uniformParams(0.0, 1.0);
+    model.addNeuronPopulation<Neuron>("Pop", 1000, {}, Neuron::VarValues(0.0, initVar<InitVarSnippet::Uniform>(uniformParams)));
+
+    model.setPrecision(GENN_FLOAT);
+}
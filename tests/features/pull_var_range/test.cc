@@ -0,0 +1,45 @@
+//--------------------------------------------------------------------------
+/*! \file pull_var_range/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "pull_var_range_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    virtual void Init() override
+    {
+    }
+};
+
+TEST_F(SimTest, PullVarRange)
+{
+    while(iT < 100) {
+        StepGeNN();
+        
+        // Download a range of variable which moves through population
+        // **NOTE** host data isn't zeroed as, on CPU backends, host and device memory are the same
+        // but, as range moves every timestep, stale values would still fail check
+        const unsigned int offset = (unsigned int)(iT % 90);
+        pullxPopRangeFromDevice(offset, 10);
+        
+        // Check range has been downloaded
+        for(unsigned int i = offset; i < (offset + 10); i++) {
+            EXPECT_FLOAT_EQ((float)(iT - 1) + (float)i, xPop[i]);
+        }
+    }
+}
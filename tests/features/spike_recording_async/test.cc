@@ -0,0 +1,106 @@
+//--------------------------------------------------------------------------
+/*! \file spike_recording_async/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "spike_recording_async_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// Recording
+//----------------------------------------------------------------------------
+struct Recording
+{
+    std::vector<unsigned long long> windowStartTimesteps;
+    std::vector<uint32_t> data;
+};
+
+void recordingCallback(const RecordingWindow *window, void *userData)
+{
+    // Append window to recording
+    auto *recording = static_cast<Recording*>(userData);
+    recording->windowStartTimesteps.push_back(window->startTimestep);
+    recording->data.insert(recording->data.end(), &window->recordSpkPop[0], 
+                           &window->recordSpkPop[4 * window->numTimesteps]);
+}
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //------------------------------------------------------------------------
+    virtual void Init() override
+    {
+        // Allocate spike recording buffers which will wrap several times during simulation
+        allocateRecordingBuffers(30);
+
+        // Allocate enough memory for 2 spikes per neuron per source
+        allocatespikeTimesPop(200);
+
+        // Loop through neurons
+        for(unsigned int n = 0; n < 100; n++) {
+            startSpikePop[n] = (n * 2) + 0;
+
+            // Configure neuron to spike twice during simulation
+            const float timestep1 = (float)n;
+            const float timestep2 = (float)(99 - n);
+            spikeTimesPop[(n * 2) + 0] = std::min(timestep1, timestep2);
+            spikeTimesPop[(n * 2) + 1] = std::max(timestep1, timestep2);
+
+            endSpikePop[n] = (n * 2) + 2;
+        }
+
+        // Upload spike times
+        pushspikeTimesPopToDevice(200);
+    }
+};
+
+TEST_F(SimTest, SpikeRecordingAsync)
+{
+    // Hand recording windows to callback
+    Recording recording;
+    setRecordingCallback(recordingCallback, &recording);
+
+    // Simulate 100 timesteps
+    while(iT < 100) {
+        StepGeNN();
+    }
+
+    // Hand final, partial window to callback
+    flushRecordingBuffers();
+
+    // Check three full windows and one partial window were recorded
+    ASSERT_EQ(recording.windowStartTimesteps, std::vector<unsigned long long>({0, 30, 60, 90}));
+    ASSERT_EQ(recording.data.size(), 400);
+
+    // Loop through timesteps
+    for(unsigned int t = 0; t < 100; t++) {
+        // Calculate indices of neurons which should spike this timestep
+        const unsigned int n1 = t;
+        const unsigned int n2 = 99 - t;
+        
+        // Build bitset 
+        uint32_t correct[4] = {0, 0, 0, 0};
+        correct[n1 / 32] |= (1 << (n1 % 32));
+        correct[n2 / 32] |= (1 << (n2 % 32));
+        
+        // Check that this matches recording passed to callback
+        EXPECT_TRUE(std::equal(&correct[0], &correct[4], &recording.data[4 * t]));
+    }
+}
@@ -0,0 +1,24 @@
+//--------------------------------------------------------------------------
+/*! \file spike_recording_split_neuron_update/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+void modelDefinition(ModelSpec &model)
+{
+    // Split neuron update into update and spike emission loops
+    // **NOTE** this preference is only supported by CPU backends
+    GENN_PREFERENCES.enableSplitNeuronUpdate = true;
+
+    model.setDT(1.0);
+    model.setName("spike_recording_split_neuron_update");
+    
+    NeuronModels::SpikeSourceArray::VarValues varInit(uninitialisedVar(), uninitialisedVar());
+    auto *pop = model.addNeuronPopulation<NeuronModels::SpikeSourceArray>("Pop", 100, {}, varInit);
+    pop->setSpikeRecordingEnabled(true);
+}
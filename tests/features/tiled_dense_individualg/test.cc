@@ -0,0 +1,63 @@
+//--------------------------------------------------------------------------
+/*! \file tiled_dense_individualg/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "tiled_dense_individualg_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Give each synapse a small integer weight so sums are exact
+        for(unsigned int i = 0; i < 20; i++) {
+            for(unsigned int j = 0; j < 1100; j++) {
+                gSyn[(i * 1100) + j] = (float)((i + j) % 7);
+            }
+        }
+    }
+};
+
+TEST_F(SimTest, TiledDenseIndividualg)
+{
+    for(unsigned int t = 0; t < 10; t++) {
+        // Every timestep, spike presynaptic neurons whose index is a multiple of t + 1
+        glbSpkCntPre[0] = 0;
+        for(unsigned int i = 0; i < 20; i += (t + 1)) {
+            glbSpkPre[glbSpkCntPre[0]++] = i;
+        }
+        pushPreSpikesToDevice();
+
+        // Step GeNN
+        StepGeNN();
+
+        // Check each postsynaptic neuron received the sum of the weights from the spiking neurons
+        for(unsigned int j = 0; j < 1100; j++) {
+            float expected = 0.0f;
+            for(unsigned int i = 0; i < 20; i += (t + 1)) {
+                expected += (float)((i + j) % 7);
+            }
+            ASSERT_FLOAT_EQ(xPost[j], expected);
+        }
+    }
+}
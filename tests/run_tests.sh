@@ -5,14 +5,17 @@ REPORT=0
 
 # Variables containing build flags corresponding to various backends
 BUILD_FLAGS_SingleThreadedCPU=-c
+BUILD_FLAGS_MultiThreadedCPU=-t
 BUILD_FLAGS_OpenCL=-l
 
 # Parse command line arguments
 OPTIND=1
-while getopts "clrd" opt; do
+while getopts "ctlrd" opt; do
     case "$opt" in
     c)  BACKENDS+=" CUDA"
         ;;
+    t)  BACKENDS+=" MultiThreadedCPU"
+        ;;
     l)  BACKENDS+=" OpenCL"
         ;;
     r) REPORT=1
@@ -1,3 +1,15 @@
+// Standard C++ includes
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// Standard C includes
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
 // Filesystem includes
 #include "path.h"
 
@@ -7,6 +19,9 @@
 // pugixml includes
 #include "pugixml/pugixml.hpp"
 
+// SpineML common includes
+#include "binaryConnectionList.h"
+
 // SpineML simulator includes
 #include "connectors.h"
 
@@ -55,6 +70,36 @@ void checkTriangle(const unsigned int *rowLength, const unsigned int *ind, const
         }
     }
 }
+
+// Write shuffled connection list where each row contains every postsynaptic index below numPost twice
+// **NOTE** delay of each synapse is based on its position within the sorted row
+std::vector<uint32_t> writeShuffledConnectionList(const std::string &filename, unsigned int numPre, unsigned int numPost)
+{
+    std::vector<uint32_t> words;
+    words.reserve(numPre * numPost * 2 * 3);
+    for(unsigned int i = 0; i < numPre; i++) {
+        for(unsigned int j = 0; j < (numPost * 2); j++) {
+            const float delay = (float)(j % 200);
+            uint32_t delayWord;
+            std::memcpy(&delayWord, &delay, sizeof(float));
+            words.insert(words.end(), {i, j / 2, delayWord});
+        }
+    }
+
+    // Shuffle synapses
+    std::vector<unsigned int> order(numPre * numPost * 2);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937(1234));
+
+    std::vector<uint32_t> shuffledWords(words.size());
+    for(size_t i = 0; i < order.size(); i++) {
+        std::copy_n(&words[order[i] * 3], 3, &shuffledWords[i * 3]);
+    }
+
+    std::ofstream file(filename, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(shuffledWords.data()), shuffledWords.size() * sizeof(uint32_t));
+    return shuffledWords;
+}
 }   // Anonymous namespace
 
 //------------------------------------------------------------------------
@@ -692,3 +737,88 @@ TEST(ConnectionListTest, BinaryFileSparse) {
     // Check number of connections matches XML
     EXPECT_EQ(remapIndices.size(), 294);
 }
+//------------------------------------------------------------------------
+TEST(ConnectionListTest, BinaryFileLargeShuffledSparseDelay) {
+    // Write connection list large enough to be read in parallel
+    const unsigned int numPre = 1000;
+    const unsigned int numPost = 600;
+    const auto words = writeShuffledConnectionList("testConnectorsLarge.bin", numPre, numPost);
+
+    const char *connectorXML =
+        "<LL:Synapse>\n"
+        "   <ConnectionList>\n"
+        "       <BinaryFile file_name=\"testConnectorsLarge.bin\" num_connections=\"1200000\" explicit_delay_flag=\"1\" packed_data=\"\"/>\n"
+        "   </ConnectionList>\n"
+        "</LL:Synapse>\n";
+
+    // Load XML and get root LL:Synapse element
+    pugi::xml_document connectorDocument;
+    connectorDocument.load_string(connectorXML);
+    auto synapse = connectorDocument.child("LL:Synapse");
+
+    // Parse XML and create sparse connector
+    filesystem::path basePath;
+    std::vector<unsigned int> remapIndices;
+    const unsigned int maxRowLength = numPost * 2;
+    std::vector<unsigned int> rowLength(numPre);
+    std::vector<unsigned int> ind(numPre * maxRowLength);
+    std::vector<uint8_t> delay(numPre * maxRowLength);
+    unsigned int *rowLengthPtr = rowLength.data();
+    unsigned int *indPtr = ind.data();
+    uint8_t *delayPtr = delay.data();
+    Connectors::create(synapse, 1.0, numPre, numPost,
+                       &rowLengthPtr, &indPtr, &delayPtr, &maxRowLength,
+                       basePath, remapIndices);
+    ASSERT_EQ(remapIndices.size(), numPre * maxRowLength);
+
+    // Build mapping from position in ragged structure back to position in file
+    std::vector<unsigned int> fileOrder(numPre * maxRowLength);
+    for(size_t s = 0; s < remapIndices.size(); s++) {
+        fileOrder[remapIndices[s]] = (unsigned int)s;
+    }
+
+    // Check rows are sorted by postsynaptic index with duplicates in file order
+    for(unsigned int i = 0; i < numPre; i++) {
+        ASSERT_EQ(rowLength[i], maxRowLength);
+        for(unsigned int j = 0; j < maxRowLength; j++) {
+            EXPECT_EQ(ind[(i * maxRowLength) + j], j / 2);
+        }
+        for(unsigned int j = 0; j < maxRowLength; j += 2) {
+            EXPECT_LT(fileOrder[(i * maxRowLength) + j], fileOrder[(i * maxRowLength) + j + 1]);
+        }
+    }
+
+    // Check remap indices point to synapse with matching pre, post and delay in ragged structure
+    for(size_t s = 0; s < remapIndices.size(); s++) {
+        const unsigned int index = remapIndices[s];
+        float expectedDelay;
+        std::memcpy(&expectedDelay, &words[(s * 3) + 2], sizeof(float));
+        EXPECT_EQ(index / maxRowLength, words[s * 3]);
+        EXPECT_EQ(ind[index], words[(s * 3) + 1]);
+        EXPECT_EQ(delay[index], (uint8_t)std::round(expectedDelay));
+    }
+    std::remove("testConnectorsLarge.bin");
+}
+//------------------------------------------------------------------------
+TEST(ConnectionListTest, BinaryFileSummary) {
+    writeShuffledConnectionList("testConnectorsSummary.bin", 10, 5);
+
+    // Check summary is calculated correctly by scanning file
+    SpineMLCommon::BinaryConnectionList connectionList("testConnectorsSummary.bin", 100, true);
+    const auto summary = connectionList.getSummary(10);
+    EXPECT_EQ(summary.maxRowLength, 10);
+    EXPECT_TRUE(summary.heterogeneousDelay);
+    EXPECT_EQ(summary.maxDelayMs, 9.0f);
+
+    // Check out of range presynaptic indices are detected
+    try
+    {
+        connectionList.getSummary(5);
+        FAIL();
+    }
+    catch(const std::runtime_error &)
+    {
+    }
+
+    std::remove("testConnectorsSummary.bin");
+}
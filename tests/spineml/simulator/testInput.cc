@@ -0,0 +1,163 @@
+// Standard C++ includes
+#include <algorithm>
+#include <map>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// pugixml includes
+#include "pugixml/pugixml.hpp"
+
+// SpineML simulator includes
+#include "input.h"
+#include "inputValue.h"
+#include "networkIO.h"
+
+using namespace SpineMLSimulator;
+
+//------------------------------------------------------------------------
+// Anonymous namespace
+//------------------------------------------------------------------------
+namespace
+{
+// Host spike buffers which inputs inject spikes into
+std::vector<unsigned int> hostSpikeCount(1);
+std::vector<unsigned int> hostSpikes;
+
+// Spikes 'pushed' by inputs in current timestep
+std::vector<unsigned int> pushedSpikes;
+
+void pushCurrentSpikes()
+{
+    pushedSpikes.assign(hostSpikes.begin(), hostSpikes.begin() + hostSpikeCount[0]);
+}
+
+template<typename I>
+std::unique_ptr<Input::Base> createInput(double dt, unsigned int popSize, const char *inputXML, pugi::xml_document &inputDocument)
+{
+    // Load XML and create input value
+    inputDocument.load_string(inputXML);
+    auto input = inputDocument.first_child();
+    std::map<std::string, InputValue::External*> externalInputs;
+    NetworkIO networkIO;
+    auto inputValue = InputValue::create(dt, popSize, input, externalInputs, networkIO);
+
+    // Allocate host spike buffers and create input
+    hostSpikeCount[0] = 0;
+    hostSpikes.resize(popSize);
+    return std::unique_ptr<Input::Base>(new I(dt, input, std::move(inputValue), popSize,
+                                              nullptr, hostSpikeCount.data(), hostSpikes.data(),
+                                              pushCurrentSpikes));
+}
+}   // Anonymous namespace
+
+//------------------------------------------------------------------------
+// RegularSpikeRate tests
+//------------------------------------------------------------------------
+TEST(RegularSpikeRateTest, Constant) {
+    // 100Hz regular input
+    pugi::xml_document inputDocument;
+    auto input = createInput<Input::RegularSpikeRate>(1.0, 10, "<ConstantInput value=\"100\" rate_based_distribution=\"regular\"/>\n",
+                                                      inputDocument);
+
+    // Check all neurons spike together every 10 timesteps
+    for(unsigned long long t = 0; t < 100; t++) {
+        input->apply(1.0, t);
+
+        if(t > 0 && (t % 10) == 0) {
+            std::sort(pushedSpikes.begin(), pushedSpikes.end());
+            ASSERT_EQ(pushedSpikes.size(), 10);
+            for(unsigned int i = 0; i < 10; i++) {
+                EXPECT_EQ(pushedSpikes[i], i);
+            }
+        }
+        else {
+            EXPECT_TRUE(pushedSpikes.empty());
+        }
+    }
+}
+//------------------------------------------------------------------------
+TEST(RegularSpikeRateTest, StartDuration) {
+    // 250Hz regular input applied to some neurons between 10ms and 30ms
+    pugi::xml_document inputDocument;
+    auto input = createInput<Input::RegularSpikeRate>(1.0, 10, "<ConstantInput value=\"250\" target_indices=\"1,3\" start_time=\"10\" duration=\"20\" rate_based_distribution=\"regular\"/>\n",
+                                                      inputDocument);
+
+    // Check neurons spike every 4 timesteps, only while input is applied
+    for(unsigned long long t = 0; t < 50; t++) {
+        pushedSpikes.clear();
+        input->apply(1.0, t);
+
+        if(t > 10 && t < 30 && ((t - 10) % 4) == 0) {
+            std::sort(pushedSpikes.begin(), pushedSpikes.end());
+            ASSERT_EQ(pushedSpikes.size(), 2);
+            EXPECT_EQ(pushedSpikes[0], 1);
+            EXPECT_EQ(pushedSpikes[1], 3);
+        }
+        else {
+            EXPECT_TRUE(pushedSpikes.empty());
+        }
+    }
+}
+//------------------------------------------------------------------------
+TEST(RegularSpikeRateTest, Fast) {
+    // Regular input faster than timestep
+    pugi::xml_document inputDocument;
+    auto input = createInput<Input::RegularSpikeRate>(1.0, 5, "<ConstantInput value=\"2000\" rate_based_distribution=\"regular\"/>\n",
+                                                      inputDocument);
+
+    // Check all neurons spike every timestep after first
+    for(unsigned long long t = 0; t < 20; t++) {
+        input->apply(1.0, t);
+        EXPECT_EQ(pushedSpikes.size(), (t == 0) ? 0 : 5);
+    }
+}
+
+//------------------------------------------------------------------------
+TEST(RegularSpikeRateTest, RateChange) {
+    // Regular input which is turned off at 25ms and back on, faster, at 40ms
+    const char *inputXML =
+        "<TimeVaryingInput rate_based_distribution=\"regular\">\n"
+        "   <TimePointValue time=\"0\" value=\"100\"/>\n"
+        "   <TimePointValue time=\"25\" value=\"0\"/>\n"
+        "   <TimePointValue time=\"40\" value=\"500\"/>\n"
+        "</TimeVaryingInput>\n";
+    pugi::xml_document inputDocument;
+    auto input = createInput<Input::RegularSpikeRate>(1.0, 3, inputXML, inputDocument);
+
+    // Check all neurons spike at expected times
+    const std::vector<unsigned long long> spikeTimesteps{10, 20, 42, 44, 46, 48};
+    for(unsigned long long t = 0; t < 50; t++) {
+        input->apply(1.0, t);
+
+        const bool shouldSpike = std::find(spikeTimesteps.cbegin(), spikeTimesteps.cend(), t) != spikeTimesteps.cend();
+        EXPECT_EQ(pushedSpikes.size(), shouldSpike ? 3 : 0);
+    }
+}
+
+//------------------------------------------------------------------------
+// PoissonSpikeRate tests
+//------------------------------------------------------------------------
+TEST(PoissonSpikeRateTest, Rate) {
+    // 10Hz Poisson input to small population
+    const unsigned int popSize = 1000;
+    const double dt = 1.0;
+    const unsigned long long numTimesteps = 1000;
+    pugi::xml_document inputDocument;
+    auto input = createInput<Input::PoissonSpikeRate>(dt, popSize, "<ConstantInput value=\"10\" rate_based_distribution=\"poisson\" rate_seed=\"1234\"/>\n",
+                                                      inputDocument);
+
+    // Simulate input, counting spikes and checking they are emitted in neuron order
+    size_t numSpikes = 0;
+    for(unsigned long long t = 0; t < numTimesteps; t++) {
+        input->apply(dt, t);
+        EXPECT_TRUE(std::is_sorted(pushedSpikes.cbegin(), pushedSpikes.cend()));
+        EXPECT_TRUE(std::all_of(pushedSpikes.cbegin(), pushedSpikes.cend(), [popSize](unsigned int i){ return i < popSize; }));
+        numSpikes += pushedSpikes.size();
+    }
+
+    // Check total number of spikes is within 5% of expected
+    const double expectedSpikes = 10.0 * popSize * (dt * numTimesteps / 1000.0);
+    EXPECT_NEAR((double)numSpikes, expectedSpikes, expectedSpikes * 0.05);
+}
@@ -16,6 +16,7 @@
 
 // SpineML simulator includes
 #include "inputValue.h"
+#include "networkIO.h"
 
 using namespace SpineMLSimulator;
 
@@ -34,7 +35,8 @@ TEST(ConstantTest, All) {
 
     // Parse XML and create input value
     std::map<std::string, InputValue::External*> externalInputs;
-    auto inputValue = InputValue::create(1.0, 10, input, externalInputs);
+    NetworkIO networkIO;
+    auto inputValue = InputValue::create(1.0, 10, input, externalInputs, networkIO);
 
     // Update for first timestep
     std::bitset<10> valuesUpdate;
@@ -70,7 +72,8 @@ TEST(ConstantTest, Indices) {
 
     // Parse XML and create input value
     std::map<std::string, InputValue::External*> externalInputs;
-    auto inputValue = InputValue::create(1.0, 10, input, externalInputs);
+    NetworkIO networkIO;
+    auto inputValue = InputValue::create(1.0, 10, input, externalInputs, networkIO);
 
     // Update for first timestep
     std::bitset<10> valuesUpdate;
@@ -113,7 +116,8 @@ TEST(ConstantArrayTest, AllArraySizeDeath) {
     try
     {
         std::map<std::string, InputValue::External*> externalInputs;
-        InputValue::create(1.0, 10, input, externalInputs);
+        NetworkIO networkIO;
+        InputValue::create(1.0, 10, input, externalInputs, networkIO);
         FAIL();
     }
     catch(const std::runtime_error &)
@@ -133,7 +137,8 @@ TEST(ConstantArrayTest, All) {
 
     // Parse XML and create input value
     std::map<std::string, InputValue::External*> externalInputs;
-    auto inputValue = InputValue::create(1.0, 4, input, externalInputs);
+    NetworkIO networkIO;
+    auto inputValue = InputValue::create(1.0, 4, input, externalInputs, networkIO);
 
     // Update for first timestep
     std::bitset<4> valuesUpdate;
@@ -183,7 +188,8 @@ TEST(ConstantArrayTest, IndicesSizeDeath) {
     try
     {
         std::map<std::string, InputValue::External*> externalInputs;
-        InputValue::create(1.0, 10, input, externalInputs);
+        NetworkIO networkIO;
+        InputValue::create(1.0, 10, input, externalInputs, networkIO);
         FAIL();
     }
     catch(const std::runtime_error &)
@@ -203,7 +209,8 @@ TEST(ConstantArrayTest, Indices) {
 
     // Parse XML and create input value
     std::map<std::string, InputValue::External*> externalInputs;
-    auto inputValue = InputValue::create(1.0, 10, input, externalInputs);
+    NetworkIO networkIO;
+    auto inputValue = InputValue::create(1.0, 10, input, externalInputs, networkIO);
 
     // Update for first timestep
     std::bitset<10> valuesUpdate;
@@ -260,7 +267,8 @@ TEST(TimeVaryingInput, All) {
 
     // Parse XML and create input value
     std::map<std::string, InputValue::External*> externalInputs;
-    auto inputValue = InputValue::create(1.0, 10, input, externalInputs);
+    NetworkIO networkIO;
+    auto inputValue = InputValue::create(1.0, 10, input, externalInputs, networkIO);
 
     // Check nothing gets updated in subsequent updates
     for(unsigned int t = 0; t < 50; t++) {
@@ -305,7 +313,8 @@ TEST(TimeVaryingInput, ShuffleAll) {
 
     // Parse XML and create input value
     std::map<std::string, InputValue::External*> externalInputs;
-    auto inputValue = InputValue::create(1.0, 10, input, externalInputs);
+    NetworkIO networkIO;
+    auto inputValue = InputValue::create(1.0, 10, input, externalInputs, networkIO);
 
     // Check nothing gets updated in subsequent updates
     for(unsigned int t = 0; t < 50; t++) {
@@ -352,7 +361,8 @@ TEST(TimeVaryingArrayInput, All) {
 
     // Parse XML and create input value
     std::map<std::string, InputValue::External*> externalInputs;
-    auto inputValue = InputValue::create(1.0, 10, input, externalInputs);
+    NetworkIO networkIO;
+    auto inputValue = InputValue::create(1.0, 10, input, externalInputs, networkIO);
 
     // Check nothing gets updated in subsequent updates
     for(unsigned int t = 0; t < 50; t++) {
@@ -0,0 +1,121 @@
+// Standard C++ includes
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+// Standard C includes
+#include <cstdio>
+#include <cstring>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// SpineML simulator includes
+#include "logWriter.h"
+
+using namespace SpineMLSimulator;
+
+//------------------------------------------------------------------------
+// Anonymous namespace
+//------------------------------------------------------------------------
+namespace
+{
+std::vector<char> readFile(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    return std::vector<char>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+void writeIntCSV(std::ostream &os, const char *item)
+{
+    uint32_t value;
+    std::memcpy(&value, item, sizeof(uint32_t));
+    os << value << "\n";
+}
+}   // Anonymous namespace
+
+//------------------------------------------------------------------------
+// LogWriter tests
+//------------------------------------------------------------------------
+TEST(LogWriterTest, Binary) {
+    // Build some data to write
+    std::vector<uint32_t> data(1000);
+    std::iota(data.begin(), data.end(), 0);
+
+    {
+        // Create writer with tiny buffer so writes both wrap around and are split into multiple records
+        LogWriter logWriter(256);
+        const unsigned int file = logWriter.openFile("testLogWriterBinary.bin");
+
+        // Write data in chunks of increasing size
+        size_t start = 0;
+        for(size_t i = 1; start < data.size(); i++) {
+            const size_t count = std::min(i * 7, data.size() - start);
+            logWriter.write(file, &data[start], sizeof(uint32_t) * count);
+            start += count;
+        }
+    }
+
+    // Check file contents match data
+    const auto fileData = readFile("testLogWriterBinary.bin");
+    ASSERT_EQ(fileData.size(), sizeof(uint32_t) * data.size());
+    EXPECT_EQ(std::memcmp(fileData.data(), data.data(), fileData.size()), 0);
+    std::remove("testLogWriterBinary.bin");
+}
+//------------------------------------------------------------------------
+TEST(LogWriterTest, Formatted) {
+    std::vector<uint32_t> data(1000);
+    std::iota(data.begin(), data.end(), 0);
+
+    {
+        // Create writer with tiny buffer shared between text and binary files
+        LogWriter logWriter(100);
+        const unsigned int binaryFile = logWriter.openFile("testLogWriterFormatted.bin");
+        const unsigned int textFile = logWriter.openFile("testLogWriterFormatted.csv", sizeof(uint32_t), writeIntCSV);
+
+        // Interleave writes to text and binary files
+        for(size_t i = 0; i < data.size(); i += 10) {
+            logWriter.write(textFile, &data[i], sizeof(uint32_t) * 10);
+            logWriter.write(binaryFile, &data[i], 3);
+        }
+    }
+
+    // Check binary file contains first three bytes of each block
+    const auto binaryData = readFile("testLogWriterFormatted.bin");
+    ASSERT_EQ(binaryData.size(), 300);
+    for(size_t i = 0; i < 100; i++) {
+        EXPECT_EQ(std::memcmp(&binaryData[i * 3], &data[i * 10], 3), 0);
+    }
+
+    // Check text file contains one line per value
+    std::ifstream textFile("testLogWriterFormatted.csv");
+    uint32_t value;
+    uint32_t expected = 0;
+    while(textFile >> value) {
+        EXPECT_EQ(value, expected++);
+    }
+    EXPECT_EQ(expected, 1000);
+    textFile.close();
+
+    std::remove("testLogWriterFormatted.bin");
+    std::remove("testLogWriterFormatted.csv");
+}
+//------------------------------------------------------------------------
+TEST(LogWriterTest, OpenAfterWriteDeath) {
+    LogWriter logWriter;
+    const unsigned int file = logWriter.openFile("testLogWriterOpen.bin");
+    const uint32_t value = 1;
+    logWriter.write(file, &value, sizeof(uint32_t));
+
+    try
+    {
+        logWriter.openFile("testLogWriterOpen2.bin");
+        FAIL();
+    }
+    catch(const std::runtime_error &)
+    {
+    }
+    std::remove("testLogWriterOpen.bin");
+}
@@ -0,0 +1,264 @@
+// Standard C++ includes
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Standard C includes
+#include <cstring>
+
+// POSIX includes
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// SpineML simulator includes
+#include "networkClient.h"
+#include "networkIO.h"
+
+using namespace SpineMLSimulator;
+
+//------------------------------------------------------------------------
+// Anonymous namespace
+//------------------------------------------------------------------------
+namespace
+{
+const char responseHello = 41;
+const char responseReceived = 42;
+
+bool receiveAll(int socket, void *data, size_t bytes)
+{
+    return (::recv(socket, data, bytes, MSG_WAITALL) == (ssize_t)bytes);
+}
+
+bool sendAll(int socket, const void *data, size_t bytes)
+{
+    return (::send(socket, data, bytes, 0) == (ssize_t)bytes);
+}
+
+//------------------------------------------------------------------------
+// LoopbackServer
+//------------------------------------------------------------------------
+//! Minimal stand-in for a remote SpineML host which serves a single connection on the loopback interface
+/*! If the client is a target, the server sends numBuffers buffers where element i of buffer b is (b * size) + i.
+    If the client is a source, the server receives numBuffers buffers, optionally holding
+    the response to the first until release is called (or a generous failsafe timeout expires) */
+class LoopbackServer
+{
+public:
+    LoopbackServer(unsigned int numBuffers, bool holdFirstResponse = false)
+    :   m_NumBuffers(numBuffers), m_HoldFirstResponse(holdFirstResponse), m_Released(false), m_Failed(false)
+    {
+        // Bind listening socket to an ephemeral port on the loopback interface
+        m_ListenSocket = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address;
+        memset(&address, 0, sizeof(sockaddr_in));
+        address.sin_family = AF_INET;
+        address.sin_port = 0;
+        address.sin_addr.s_addr = inet_addr("127.0.0.1");
+        socklen_t addressLength = sizeof(sockaddr_in);
+        if(bind(m_ListenSocket, reinterpret_cast<sockaddr*>(&address), addressLength) < 0
+           || listen(m_ListenSocket, 1) < 0
+           || getsockname(m_ListenSocket, reinterpret_cast<sockaddr*>(&address), &addressLength) < 0)
+        {
+            throw std::runtime_error("Unable to create loopback server");
+        }
+        m_Port = ntohs(address.sin_port);
+
+        m_Thread = std::thread(&LoopbackServer::serverThreadFunc, this);
+    }
+
+    ~LoopbackServer()
+    {
+        join();
+        close(m_ListenSocket);
+    }
+
+    void join()
+    {
+        if(m_Thread.joinable()) {
+            m_Thread.join();
+        }
+    }
+
+    //! Allow server to send held response
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(m_ReleaseMutex);
+        m_Released = true;
+        m_ReleaseCondition.notify_all();
+    }
+
+    unsigned int getPort() const{ return m_Port; }
+    bool hasFailed() const{ return m_Failed; }
+    const std::vector<std::vector<double>> &getReceivedBuffers() const{ return m_ReceivedBuffers; }
+
+private:
+    void serverThreadFunc()
+    {
+        const int socket = accept(m_ListenSocket, nullptr, nullptr);
+        m_Failed = (socket < 0) || !serve(socket);
+        if(socket >= 0) {
+            close(socket);
+        }
+    }
+
+    bool serve(int socket)
+    {
+        // Perform handshake
+        char mode;
+        char dataType;
+        unsigned int size;
+        int connectionNameLength;
+        if(!receiveAll(socket, &mode, sizeof(char)) || !sendAll(socket, &responseHello, sizeof(char))
+           || !receiveAll(socket, &dataType, sizeof(char)) || !sendAll(socket, &responseReceived, sizeof(char))
+           || !receiveAll(socket, &size, sizeof(unsigned int)) || !sendAll(socket, &responseReceived, sizeof(char))
+           || !receiveAll(socket, &connectionNameLength, sizeof(int)))
+        {
+            return false;
+        }
+        std::string connectionName(connectionNameLength, ' ');
+        if(!receiveAll(socket, &connectionName[0], connectionNameLength) || !sendAll(socket, &responseReceived, sizeof(char))) {
+            return false;
+        }
+
+        // If client is a target, send buffers
+        std::vector<double> buffer(size);
+        if(mode == static_cast<char>(NetworkClient::Mode::Target)) {
+            for(unsigned int b = 0; b < m_NumBuffers; b++) {
+                for(unsigned int i = 0; i < size; i++) {
+                    buffer[i] = (double)((b * size) + i);
+                }
+
+                char response;
+                if(!sendAll(socket, buffer.data(), sizeof(double) * size) || !receiveAll(socket, &response, sizeof(char))
+                   || response != responseReceived)
+                {
+                    return false;
+                }
+            }
+        }
+        // Otherwise, receive buffers
+        else {
+            for(unsigned int b = 0; b < m_NumBuffers; b++) {
+                if(!receiveAll(socket, buffer.data(), sizeof(double) * size)) {
+                    return false;
+                }
+                m_ReceivedBuffers.push_back(buffer);
+
+                // If first response should be held, wait for release, failing if it never comes
+                if(b == 0 && m_HoldFirstResponse) {
+                    std::unique_lock<std::mutex> lock(m_ReleaseMutex);
+                    if(!m_ReleaseCondition.wait_for(lock, std::chrono::seconds(10), [this](){ return m_Released; })) {
+                        return false;
+                    }
+                }
+                if(!sendAll(socket, &responseReceived, sizeof(char))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    const unsigned int m_NumBuffers;
+    const bool m_HoldFirstResponse;
+    std::mutex m_ReleaseMutex;
+    std::condition_variable m_ReleaseCondition;
+    bool m_Released;
+    int m_ListenSocket;
+    unsigned int m_Port;
+    bool m_Failed;
+    std::vector<std::vector<double>> m_ReceivedBuffers;
+    std::thread m_Thread;
+};
+
+void testTransfer(unsigned int lookahead)
+{
+    const unsigned int numBuffers = 100;
+    const unsigned int size = 10;
+    LoopbackServer inputServer(numBuffers);
+    LoopbackServer logServer(numBuffers);
+    {
+        // Connect input and log clients and add to network IO
+        NetworkClient inputClient("127.0.0.1", inputServer.getPort(), size, NetworkClient::DataType::Analogue,
+                                  NetworkClient::Mode::Target, "input");
+        NetworkClient logClient("127.0.0.1", logServer.getPort(), size, NetworkClient::DataType::Analogue,
+                                NetworkClient::Mode::Source, "log");
+        NetworkIO networkIO;
+        networkIO.addClient(inputClient);
+        networkIO.addClient(logClient);
+        networkIO.start(lookahead);
+        EXPECT_EQ(inputClient.isPipelined(), lookahead > 0);
+        EXPECT_EQ(logClient.isPipelined(), lookahead > 0);
+
+        // Receive buffers, check they are correct and send them back via log client
+        std::vector<double> buffer(size);
+        for(unsigned int b = 0; b < numBuffers; b++) {
+            ASSERT_TRUE(inputClient.receive(buffer));
+            for(unsigned int i = 0; i < size; i++) {
+                ASSERT_EQ(buffer[i], (double)((b * size) + i));
+            }
+            ASSERT_TRUE(logClient.send(buffer));
+        }
+    }
+
+    // Check log server received all buffers in order
+    inputServer.join();
+    logServer.join();
+    EXPECT_FALSE(inputServer.hasFailed());
+    EXPECT_FALSE(logServer.hasFailed());
+    ASSERT_EQ(logServer.getReceivedBuffers().size(), numBuffers);
+    for(unsigned int b = 0; b < numBuffers; b++) {
+        for(unsigned int i = 0; i < size; i++) {
+            EXPECT_EQ(logServer.getReceivedBuffers()[b][i], (double)((b * size) + i));
+        }
+    }
+}
+}   // Anonymous namespace
+
+//------------------------------------------------------------------------
+// NetworkClient tests
+//------------------------------------------------------------------------
+TEST(NetworkClientTest, Blocking) {
+    testTransfer(0);
+}
+//------------------------------------------------------------------------
+TEST(NetworkClientTest, Pipelined) {
+    testTransfer(4);
+}
+//------------------------------------------------------------------------
+TEST(NetworkClientTest, PipelinedOverlap) {
+    // Create server which holds its response to the first buffer until released
+    const unsigned int numBuffers = 4;
+    LoopbackServer logServer(numBuffers, true);
+    {
+        NetworkClient logClient("127.0.0.1", logServer.getPort(), 1, NetworkClient::DataType::Analogue,
+                                NetworkClient::Mode::Source, "log");
+        NetworkIO networkIO;
+        networkIO.addClient(logClient);
+        networkIO.start(numBuffers);
+
+        // Send all buffers and then release server's first response
+        // **NOTE** if sends waited for responses, the server would time out waiting to be released and fail
+        for(unsigned int b = 0; b < numBuffers; b++) {
+            ASSERT_TRUE(logClient.send(std::vector<double>{(double)b}));
+        }
+        logServer.release();
+    }
+
+    // Check all buffers were in flight before first response and were sent before network IO was destroyed
+    logServer.join();
+    EXPECT_FALSE(logServer.hasFailed());
+    ASSERT_EQ(logServer.getReceivedBuffers().size(), numBuffers);
+    for(unsigned int b = 0; b < numBuffers; b++) {
+        EXPECT_EQ(logServer.getReceivedBuffers()[b][0], (double)b);
+    }
+}
@@ -1,6 +1,7 @@
 // C++ standard includes
 #include <limits>
 #include <tuple>
+#include <unordered_map>
 
 // C standard includes
 #include <cstdlib>
@@ -30,7 +31,7 @@ TEST(CodeGenUtils, foo123) {
     const std::string code = "int foo123 = 6;";
 
     std::string substitutedCode = code;
-    regexVarSubstitute(substitutedCode, "foo", "bar");
+    varSubstitute(substitutedCode, "foo", "bar");
     ASSERT_EQ(code, substitutedCode);
 }
 
@@ -39,10 +40,56 @@ TEST(CodeGenUtils, not2well) {
     const std::string code = "int not2well = 6;";
 
     std::string substitutedCode = code;
-    regexVarSubstitute(substitutedCode, "well", "hell");
+    varSubstitute(substitutedCode, "well", "hell");
     ASSERT_EQ(code, substitutedCode);
 }
 
+TEST(CodeGenUtils, VarSubstitute) {
+    std::string code = "a*a + a_b + ba + 2a + a";
+    ASSERT_TRUE(varSubstitute(code, "a", "c"));
+    ASSERT_EQ(code, "c*c + a_b + ba + 2a + c");
+    ASSERT_FALSE(varSubstitute(code, "a", "c"));
+}
+
+TEST(CodeGenUtils, FuncSubstitute) {
+    std::string code = "sinf(cosf (x)) + sinf + asinf(y)";
+    ASSERT_TRUE(funcSubstitute(code, {{"sinf", "sin"}, {"cosf", "cos"}}));
+    ASSERT_EQ(code, "sin(cos (x)) + sinf + asinf(y)");
+}
+
+// Check that nested variable substitutions are applied in the same order as if each was applied in turn
+TEST(CodeGenUtils, NestedVarSubstitution) {
+    Substitutions subs;
+    subs.addVarSubstitution("a", "$(b) + 1");
+    subs.addVarSubstitution("b", "x");
+    subs.addVarSubstitution("c", "$(a)");
+
+    std::string code = "$(c) * $(a) * $(b) * $(d)";
+    subs.apply(code);
+    ASSERT_EQ(code, "$(a) * x + 1 * x * $(d)");
+}
+
+// Check substituting variables and functions from maps matches substituting them one at a time
+TEST(CodeGenUtils, MapSubstitution) {
+    const std::string code = "V += (I * expf(-DT / tau)) + sinf (V_2) * powf(V, 2.0f) + expf;";
+    const std::unordered_map<std::string, std::string> vars{{"V", "lV"}, {"I", "lI"}, {"tau", "group->tau"}};
+    const std::unordered_map<std::string, std::string> funcs{{"expf", "exp"}, {"sinf", "sin"}, {"powf", "pow"}};
+
+    std::string mapCode = code;
+    varSubstitute(mapCode, vars);
+    funcSubstitute(mapCode, funcs);
+    ASSERT_EQ(mapCode, "lV += (lI * exp(-DT / group->tau)) + sin (V_2) * pow(lV, 2.0f) + expf;");
+
+    std::string singleCode = code;
+    for(const auto &v : vars) {
+        varSubstitute(singleCode, v.first, v.second);
+    }
+    for(const auto &f : funcs) {
+        funcSubstitute(singleCode, f.first, f.second);
+    }
+    ASSERT_EQ(mapCode, singleCode);
+}
+
 // Check that generic maths functions DON'T get messed with
 TEST(CodeGenUtils, rint) {
     const std::string code = "$(value) = (uint8_t)rint(normal / DT);";
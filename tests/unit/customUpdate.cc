@@ -486,6 +486,39 @@ TEST(CustomUpdates, WUVarSynapseGroupChecks)
     model.finalize();
 }
 //--------------------------------------------------------------------------
+TEST(CustomUpdates, WUVarDeltaEncodedChecks)
+{
+    ModelSpecInternal model;
+
+    // Add two neuron group to model
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 25, paramVals, varVals);
+
+    auto *sg1 = model.addSynapsePopulation<WeightUpdateModels::StaticPulseDendriticDelay, PostsynapticModels::DeltaCurr>(
+        "Synapses1", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+        "Pre", "Post",
+        {}, {1.0, 4},
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({0.1}));
+    sg1->setDeltaEncodedSparseIndEnabled(true);
+
+    Sum::VarValues sumVarValues(0.0);
+    Sum::WUVarReferences sumVarReferences(createWUVarRef(sg1, "g"), createWUVarRef(sg1, "g"));
+
+    model.addCustomUpdate<Sum>("SumWeight", "CustomUpdate",
+                               {}, sumVarValues, sumVarReferences);
+
+    // Check custom weight updates can't be attached to synapse groups with delta-encoded sparse indices
+    try {
+        model.finalize();
+        FAIL();
+    }
+    catch(const std::runtime_error &) {
+    }
+}
+//--------------------------------------------------------------------------
 TEST(CustomUpdates, BatchingVars)
 {
     ModelSpecInternal model;
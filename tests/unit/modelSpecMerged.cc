@@ -1093,4 +1093,62 @@ TEST(ModelSpecMerged, CompareCustomUpdateVarRefTargetChanges)
                  model.addCustomUpdate<Sum>("CU" + std::to_string(c), "Group", paramVals, vals, varRefs);
              }
          });
-}
\ No newline at end of file
+}
+//--------------------------------------------------------------------------
+TEST(ModelSpecMerged, CompareModuleChanges)
+{
+    // Build model with specified Izhikevich 'a' parameter and STDP potentiation rate 
+    // and return hash digests of neuron update, synapse update and init modules
+    auto getModuleHashes = 
+        [](double a, double aPlus)
+        {
+            ModelSpecInternal model;
+            model.setName("test");
+            model.setDT(0.1);
+
+            NeuronModels::Izhikevich::VarValues neuronVarVals(0.0, 0.0);
+            NeuronModels::Izhikevich::ParamValues neuronParamVals(a, 0.2, -65.0, 4.0);
+            model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 100, 
+                                                                neuronParamVals, neuronVarVals);
+            model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 100, 
+                                                                neuronParamVals, neuronVarVals);
+
+            STDPAdditive::ParamValues params(20.0, 20.0, aPlus, -0.001, 0.0, 1.0);
+            STDPAdditive::VarValues varValues(0.5);
+            STDPAdditive::PreVarValues preVarValues(0.0);
+            STDPAdditive::PostVarValues postVarValues(0.0);
+            model.addSynapsePopulation<STDPAdditive, PostsynapticModels::DeltaCurr>(
+                "Synapse", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+                "Pre", "Post",
+                params, varValues, preVarValues, postVarValues,
+                {}, {},
+                initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({0.1}));
+            model.finalize();
+
+            CodeGenerator::SingleThreadedCPU::Preferences preferences;
+            CodeGenerator::SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+            CodeGenerator::ModelSpecMerged modelSpecMerged(model, backend);
+            return std::array<boost::uuids::detail::sha1::digest_type, 3>{
+                modelSpecMerged.getNeuronUpdateModuleHashDigest(backend),
+                modelSpecMerged.getSynapseUpdateModuleHashDigest(backend),
+                modelSpecMerged.getInitModuleHashDigest(backend)};
+        };
+
+    const auto baseline = getModuleHashes(0.02, 0.001);
+
+    // Check rebuilding identical model results in identical modules
+    const auto identical = getModuleHashes(0.02, 0.001);
+    ASSERT_EQ(identical, baseline);
+
+    // Check changing neuron parameter only changes neuron update module
+    const auto neuronChange = getModuleHashes(0.1, 0.001);
+    ASSERT_NE(neuronChange[0], baseline[0]);
+    ASSERT_EQ(neuronChange[1], baseline[1]);
+    ASSERT_EQ(neuronChange[2], baseline[2]);
+
+    // Check changing weight update parameter only changes synapse update module
+    const auto synapseChange = getModuleHashes(0.02, 0.002);
+    ASSERT_EQ(synapseChange[0], baseline[0]);
+    ASSERT_NE(synapseChange[1], baseline[1]);
+    ASSERT_EQ(synapseChange[2], baseline[2]);
+}
@@ -1248,3 +1248,137 @@ TEST(SynapseGroup, InvalidPSOutputVar)
     catch (const std::runtime_error &) {
     }
 }
+
+TEST(SynapseGroup, TiledDenseUpdate)
+{
+    ModelSpec model;
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 10, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Post", 10, {}, {});
+    auto *dense = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Dense", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+        "Pre", "Post",
+        {}, { 1.0 },
+        {}, {});
+    auto *sparse = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Sparse", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+        "Pre", "Post",
+        {}, { 1.0 },
+        {}, {});
+
+    // Check tiled dense update can be enabled on dense synapse groups
+    dense->setTiledDenseUpdateEnabled(true);
+    ASSERT_TRUE(dense->isTiledDenseUpdateEnabled());
+
+    // Check it can't be enabled on sparse ones
+    try {
+        sparse->setTiledDenseUpdateEnabled(true);
+        FAIL();
+    }
+    catch (const std::runtime_error &) {
+    }
+}
+
+TEST(SynapseGroup, PostsynapticGather)
+{
+    ModelSpec model;
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 10, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Post", 10, {}, {});
+    auto *dense = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Dense", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+        "Pre", "Post",
+        {}, { 1.0 },
+        {}, {});
+    auto *sparse = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Sparse", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+        "Pre", "Post",
+        {}, { 1.0 },
+        {}, {});
+    auto *slave = model.addSlaveSynapsePopulation<PostsynapticModels::DeltaCurr>(
+        "Slave", "Sparse", NO_DELAY,
+        "Pre", "Post",
+        {}, {});
+
+    // Check postsynaptic gather can be enabled on sparse synapse groups and that weight sharing slaves inherit it
+    sparse->setPostsynapticGatherEnabled(true);
+    ASSERT_TRUE(sparse->isPostsynapticGatherEnabled());
+    ASSERT_TRUE(slave->isPostsynapticGatherEnabled());
+
+    // Check it can't be enabled on dense ones
+    try {
+        dense->setPostsynapticGatherEnabled(true);
+        FAIL();
+    }
+    catch (const std::runtime_error &) {
+    }
+
+    // Check it can't be set on weight sharing slaves
+    try {
+        slave->setPostsynapticGatherEnabled(false);
+        FAIL();
+    }
+    catch (const std::runtime_error &) {
+    }
+}
+//--------------------------------------------------------------------------
+TEST(SynapseGroup, DeltaEncodedSparseInd)
+{
+    ModelSpec model;
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 10, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Post", 20000, {}, {});
+    auto *dense = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Dense", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+        "Pre", "Post",
+        {}, { 1.0 },
+        {}, {});
+    auto *manual = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Manual", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+        "Pre", "Post",
+        {}, { 1.0 },
+        {}, {});
+    auto *sparse = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Sparse", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+        "Pre", "Post",
+        {}, { 1.0 },
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+    auto *slave = model.addSlaveSynapsePopulation<PostsynapticModels::DeltaCurr>(
+        "Slave", "Sparse", NO_DELAY,
+        "Pre", "Post",
+        {}, {});
+
+    // Check delta-encoded sparse indices can be enabled on sparse synapse groups
+    // whose connectivity is built from rows and that weight sharing slaves inherit them
+    sparse->setDeltaEncodedSparseIndEnabled(true);
+    ASSERT_TRUE(sparse->isDeltaEncodedSparseIndEnabled());
+    ASSERT_TRUE(slave->isDeltaEncodedSparseIndEnabled());
+
+    // Check one byte is required per synapse plus one for each further 7 bits the largest postsynaptic index 
+    // requires, limited by the number of deltas which can be this large while still summing to less than 20000
+    ASSERT_EQ(sparse->getMaxDeltaEncodedRowBytes(), 3);
+    sparse->setMaxConnections(200);
+    ASSERT_EQ(sparse->getMaxDeltaEncodedRowBytes(), 200 + (19999 / 128) + (19999 / 16384));
+
+    // Check they can't be enabled on dense ones
+    try {
+        dense->setDeltaEncodedSparseIndEnabled(true);
+        FAIL();
+    }
+    catch (const std::runtime_error &) {
+    }
+
+    // Check they can't be enabled on manually initialised sparse ones
+    try {
+        manual->setDeltaEncodedSparseIndEnabled(true);
+        FAIL();
+    }
+    catch (const std::runtime_error &) {
+    }
+
+    // Check they can't be set on weight sharing slaves
+    try {
+        slave->setDeltaEncodedSparseIndEnabled(false);
+        FAIL();
+    }
+    catch (const std::runtime_error &) {
+    }
+}
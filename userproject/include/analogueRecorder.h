@@ -1,11 +1,19 @@
 #pragma once
 
 // Standard C++ includes
+#include <algorithm>
+#include <condition_variable>
 #include <fstream>
 #include <initializer_list>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
+// Standard C includes
+#include <cstdint>
+
 //----------------------------------------------------------------------------
 // AnalogueRecorder
 //----------------------------------------------------------------------------
@@ -46,3 +54,167 @@ private:
     const unsigned int m_PopSize;
     const std::string m_Delimiter;
 };
+
+//----------------------------------------------------------------------------
+// AnalogueRecorderBinary
+//----------------------------------------------------------------------------
+//! Class to record variables to a binary file. On the simulation thread, record simply copies
+//! each variable into a preallocated block which is written to file on a background thread once full.
+//! Files start with a 24 byte header: the characters "GANL", a uint32 format version, uint32 population size,
+//! uint32 number of variables, uint32 size of each value in bytes and 4 bytes of padding. This is followed
+//! by blocks, each consisting of a uint32 number of timesteps, 4 bytes of padding, the double precision time
+//! of each timestep and then, for each variable, its values at each timestep. These can be read using
+//! userproject/python/analogue_recording.py
+template<typename T>
+class AnalogueRecorderBinary
+{
+public:
+    /*! \param filename string containing filename to write to.
+        \param variables pointers to host copies of variables to record
+        \param popSize number of neurons in population
+        \param blockTimesteps how many timesteps of data to buffer before writing to file */
+    AnalogueRecorderBinary(const std::string &filename, std::initializer_list<T*> variables, unsigned int popSize,
+                           unsigned int blockTimesteps = 1000)
+    :   m_Stream(filename, std::ofstream::binary), m_Variables(variables), m_PopSize(popSize),
+        m_BlockTimesteps(std::max(1u, blockTimesteps)), m_CurrentBlock(0), m_PendingBlock(nullptr), m_Stop(false)
+    {
+        if(!m_Stream.good()) {
+            throw std::runtime_error("Unable to open analogue recording file '" + filename + "'");
+        }
+
+        // Write header
+        const char magic[4] = {'G', 'A', 'N', 'L'};
+        const uint32_t header[5] = {1, popSize, (uint32_t)m_Variables.size(), sizeof(T), 0};
+        m_Stream.write(magic, sizeof(magic));
+        m_Stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+        // Allocate blocks
+        for(auto &b : m_Blocks) {
+            b.numTimesteps = 0;
+            b.times.resize(m_BlockTimesteps);
+            b.values.resize((size_t)m_BlockTimesteps * m_PopSize * m_Variables.size());
+        }
+
+        // Start writer thread
+        m_WriterThread = std::thread(&AnalogueRecorderBinary::writerThreadFunc, this);
+    }
+
+    AnalogueRecorderBinary(const std::string &filename, T *variable, unsigned int popSize, unsigned int blockTimesteps = 1000)
+    :   AnalogueRecorderBinary(filename, {variable}, popSize, blockTimesteps)
+    {
+    }
+
+    ~AnalogueRecorderBinary()
+    {
+        // Write any partially-filled block
+        if(m_Blocks[m_CurrentBlock].numTimesteps > 0) {
+            submitCurrentBlock();
+        }
+
+        // Signal writer thread to stop once it has written pending block and wait for it
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stop = true;
+        }
+        m_BlockPending.notify_one();
+        m_WriterThread.join();
+    }
+
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    void record(double t)
+    {
+        // Copy time and variables into current block
+        Block &block = m_Blocks[m_CurrentBlock];
+        block.times[block.numTimesteps] = t;
+        for(size_t v = 0; v < m_Variables.size(); v++) {
+            std::copy_n(m_Variables[v], m_PopSize, &block.values[((v * m_BlockTimesteps) + block.numTimesteps) * m_PopSize]);
+        }
+
+        // If block is full, hand it to writer thread
+        block.numTimesteps++;
+        if(block.numTimesteps == m_BlockTimesteps) {
+            submitCurrentBlock();
+        }
+    }
+
+private:
+    //----------------------------------------------------------------------------
+    // Block
+    //----------------------------------------------------------------------------
+    struct Block
+    {
+        unsigned int numTimesteps;
+        std::vector<double> times;
+        std::vector<T> values;
+    };
+
+    //----------------------------------------------------------------------------
+    // Private methods
+    //----------------------------------------------------------------------------
+    void submitCurrentBlock()
+    {
+        // Wait for writer thread to finish writing previous block
+        // **NOTE** this is the block we will fill next
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_BlockWritten.wait(lock, [this](){ return (m_PendingBlock == nullptr); });
+
+        // Make current block pending and switch to other block
+        m_PendingBlock = &m_Blocks[m_CurrentBlock];
+        m_CurrentBlock = 1 - m_CurrentBlock;
+        lock.unlock();
+        m_BlockPending.notify_one();
+    }
+
+    void writerThreadFunc()
+    {
+        while(true) {
+            // Wait for a block to be pending or for writer to be stopped
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_BlockPending.wait(lock, [this](){ return (m_PendingBlock != nullptr || m_Stop); });
+            if(m_PendingBlock == nullptr) {
+                break;
+            }
+            Block *block = m_PendingBlock;
+            lock.unlock();
+
+            // Write block header and times
+            const uint32_t blockHeader[2] = {block->numTimesteps, 0};
+            m_Stream.write(reinterpret_cast<const char*>(blockHeader), sizeof(blockHeader));
+            m_Stream.write(reinterpret_cast<const char*>(block->times.data()), sizeof(double) * block->numTimesteps);
+
+            // Write each variable's values for timesteps in block
+            const size_t variableValues = (size_t)block->numTimesteps * m_PopSize;
+            for(size_t v = 0; v < m_Variables.size(); v++) {
+                m_Stream.write(reinterpret_cast<const char*>(&block->values[v * m_BlockTimesteps * m_PopSize]), sizeof(T) * variableValues);
+            }
+            block->numTimesteps = 0;
+
+            // Return block to simulation thread
+            lock.lock();
+            m_PendingBlock = nullptr;
+            lock.unlock();
+            m_BlockWritten.notify_one();
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    std::ofstream m_Stream;
+    std::vector<T*> m_Variables;
+    const unsigned int m_PopSize;
+    const unsigned int m_BlockTimesteps;
+
+    //! Blocks are alternately filled by simulation thread and written by writer thread
+    Block m_Blocks[2];
+    unsigned int m_CurrentBlock;
+
+    std::thread m_WriterThread;
+    std::mutex m_Mutex;
+    std::condition_variable m_BlockPending;
+    std::condition_variable m_BlockWritten;
+    Block *m_PendingBlock;
+    bool m_Stop;
+};
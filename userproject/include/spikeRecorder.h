@@ -5,6 +5,7 @@
 #include <fstream>
 #include <iterator>
 #include <list>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -50,7 +51,8 @@ protected:
     void recordSpikes(double t, unsigned int spikeCount, const unsigned int *currentSpikes)
     {
         for(unsigned int i = 0; i < spikeCount; i++) {
-            m_Stream << t << m_Delimiter << currentSpikes[i] << std::endl;
+            // **NOTE** std::endl would flush the stream after every spike
+            m_Stream << t << m_Delimiter << currentSpikes[i] << "\n";
         }
     }
 
@@ -105,7 +107,7 @@ public:
             // Loop through spikes
             for(unsigned int spike : timestep.second) {
                 // Write CSV
-                m_Stream << timestep.first << m_Delimiter << spike << std::endl;
+                m_Stream << timestep.first << m_Delimiter << spike << "\n";
             }
         }
 
@@ -210,6 +212,106 @@ inline void writeBinarySpikeRecording(const std::string &filename, const uint32_
 }
 
 
+//----------------------------------------------------------------------------
+// SpikeRecordingWriterBinary
+//----------------------------------------------------------------------------
+//! Class to write spikes recorded using GeNN's spike recording system to a binary file, buffering
+//! them in memory so they are written in large blocks. Files start with a 32 byte header:
+//! the characters "GSPK", a uint32 format version, uint32 population size, uint32 batch size,
+//! double timestep and double start time. This is followed by the recording bitfields, in the
+//! same layout as ``recordSpk<neuron group name>``, which can be read using userproject/python/spike_recording.py
+class SpikeRecordingWriterBinary
+{
+public:
+    /*! \param filename string containing filename to write to.
+        \param popSize number of neurons in population
+        \param dt double precision number specifying size of each timestep
+        \param startTime double precision number specifying time of first timestep written
+        \param batchSize batch size of model
+        \param bufferBytes how many bytes of spike recording data to buffer before writing to file */
+    SpikeRecordingWriterBinary(const std::string &filename, unsigned int popSize, double dt, double startTime = 0.0,
+                               unsigned int batchSize = 1, size_t bufferBytes = 8 * 1024 * 1024)
+    :   m_Stream(filename, std::ofstream::binary), m_TimestepWords(((popSize + 31) / 32) * batchSize),
+        m_NumTimesteps(0)
+    {
+        if(!m_Stream.good()) {
+            throw std::runtime_error("Unable to open spike recording file '" + filename + "'");
+        }
+
+        // Write header
+        const char magic[4] = {'G', 'S', 'P', 'K'};
+        const uint32_t header[3] = {1, popSize, batchSize};
+        m_Stream.write(magic, sizeof(magic));
+        m_Stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+        m_Stream.write(reinterpret_cast<const char*>(&dt), sizeof(double));
+        m_Stream.write(reinterpret_cast<const char*>(&startTime), sizeof(double));
+
+        // Reserve buffer
+        m_Buffer.reserve(std::max<size_t>(1, bufferBytes / sizeof(uint32_t)));
+    }
+
+// GCC 4.x does not provide a move constructor for ofstream
+#if !defined(__GNUC__) || __clang__ || __GNUC__ > 4
+    SpikeRecordingWriterBinary(SpikeRecordingWriterBinary&& other)
+    :   m_Stream(std::move(other.m_Stream)), m_TimestepWords(other.m_TimestepWords),
+        m_NumTimesteps(other.m_NumTimesteps), m_Buffer(std::move(other.m_Buffer))
+    {
+    }
+#endif
+
+    ~SpikeRecordingWriterBinary()
+    {
+        flush();
+    }
+
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    //! Append spike recording data
+    /*! \param spkRecord pointer to spike recording data to write (accessable via ``recordSpk<neuron group name>`` or ``recordSpkEvent<neuron group name>``).
+        \param numTimesteps how many timesteps were recorded (should match the value passed to ``allocateRecordingBuffers``). */
+    void write(const uint32_t *spkRecord, unsigned int numTimesteps)
+    {
+        const size_t numWords = m_TimestepWords * numTimesteps;
+        m_NumTimesteps += numTimesteps;
+
+        // If data won't fit in remaining buffer space, flush buffer
+        if((m_Buffer.size() + numWords) > m_Buffer.capacity()) {
+            flush();
+        }
+
+        // If data won't fit in buffer at all, write it directly, otherwise add it to buffer
+        if(numWords > m_Buffer.capacity()) {
+            m_Stream.write(reinterpret_cast<const char*>(spkRecord), sizeof(uint32_t) * numWords);
+        }
+        else {
+            m_Buffer.insert(m_Buffer.end(), spkRecord, spkRecord + numWords);
+        }
+    }
+
+    //! Write any buffered spike recording data to file
+    void flush()
+    {
+        if(!m_Buffer.empty()) {
+            m_Stream.write(reinterpret_cast<const char*>(m_Buffer.data()), sizeof(uint32_t) * m_Buffer.size());
+            m_Buffer.clear();
+        }
+        m_Stream.flush();
+    }
+
+    //! Get total number of timesteps written
+    unsigned int getNumTimesteps() const{ return m_NumTimesteps; }
+
+private:
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    std::ofstream m_Stream;
+    const size_t m_TimestepWords;
+    unsigned int m_NumTimesteps;
+    std::vector<uint32_t> m_Buffer;
+};
+
 inline int _clz(unsigned int value)
 {
 #ifdef _WIN32
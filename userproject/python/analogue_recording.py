@@ -0,0 +1,84 @@
+import numpy as np
+import matplotlib.pyplot as plt
+import sys
+
+# Header written by AnalogueRecorderBinary in analogueRecorder.h
+header_dtype = np.dtype([("magic", "S4"), ("version", "<u4"), ("pop_size", "<u4"),
+                         ("num_variables", "<u4"), ("value_bytes", "<u4"), ("padding", "<u4")])
+
+# Header preceding each block of timesteps
+block_header_dtype = np.dtype([("num_timesteps", "<u4"), ("padding", "<u4")])
+
+def load(filename):
+    # Read header
+    header = np.fromfile(filename, dtype=header_dtype, count=1)[0]
+    if header["magic"] != b"GANL" or header["version"] != 1:
+        raise Exception("'%s' is not a GeNN binary analogue recording file" % filename)
+
+    pop_size = int(header["pop_size"])
+    num_variables = int(header["num_variables"])
+    value_dtype = np.dtype("<f4") if header["value_bytes"] == 4 else np.dtype("<f8")
+
+    # Memory map remainder of file
+    data = np.memmap(filename, dtype=np.uint8, mode="r", offset=header_dtype.itemsize)
+
+    # Loop through blocks
+    times = []
+    values = [[] for _ in range(num_variables)]
+    offset = 0
+    while offset < len(data):
+        num_timesteps = int(data[offset:offset + block_header_dtype.itemsize].view(block_header_dtype)[0]["num_timesteps"])
+        offset += block_header_dtype.itemsize
+
+        # Read times
+        times.append(data[offset:offset + (8 * num_timesteps)].view("<f8"))
+        offset += 8 * num_timesteps
+
+        # Read values of each variable
+        variable_bytes = value_dtype.itemsize * num_timesteps * pop_size
+        for v in range(num_variables):
+            values[v].append(np.reshape(data[offset:offset + variable_bytes].view(value_dtype),
+                                        (num_timesteps, pop_size)))
+            offset += variable_bytes
+
+    # Concatenate blocks, returning times and, for each variable, an array of values with a row per timestep
+    return (np.concatenate(times) if len(times) > 0 else np.empty(0),
+            [np.concatenate(v) if len(v) > 0 else np.empty((0, pop_size), dtype=value_dtype) for v in values])
+
+def plot(filename, time_range, neuron_range, axis, variable=0):
+    # Load data
+    times, values = load(filename)
+    values = values[variable]
+
+    # If a time range was specified, apply mask
+    if time_range is not None:
+        mask = ((times >= time_range[0]) & (times < time_range[1]))
+        times = times[mask]
+        values = values[mask]
+
+    # If a neuron range was specified, select columns
+    if neuron_range is not None:
+        values = values[:, neuron_range[0]:neuron_range[1]]
+
+    return axis.plot(times, values)
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2:
+        print("Usage: analogue_recording.py filename [min_time max_time] [min_neuron max_neuron]")
+    else:
+        # Parse time range
+        time_range = None
+        if len(sys.argv) > 3:
+            time_range = (float(sys.argv[2]), float(sys.argv[3]))
+
+        # Parse neuron range
+        neuron_range = None
+        if len(sys.argv) > 5:
+            neuron_range = (int(sys.argv[4]), int(sys.argv[5]))
+
+        # Plot and show figure
+        fig, axis = plt.subplots()
+        plot(sys.argv[1], time_range, neuron_range, axis)
+        axis.set_xlabel("Time [ms]")
+        axis.set_ylabel("Value")
+        plt.show()
@@ -0,0 +1,72 @@
+import numpy as np
+import matplotlib.pyplot as plt
+import sys
+
+# Header written by SpikeRecordingWriterBinary in spikeRecorder.h
+header_dtype = np.dtype([("magic", "S4"), ("version", "<u4"), ("pop_size", "<u4"),
+                         ("batch_size", "<u4"), ("dt", "<f8"), ("start_time", "<f8")])
+
+def load(filename, batch=0):
+    # Read header
+    header = np.fromfile(filename, dtype=header_dtype, count=1)[0]
+    if header["magic"] != b"GSPK" or header["version"] != 1:
+        raise Exception("'%s' is not a GeNN binary spike recording file" % filename)
+
+    # Memory map recording data, viewing it as bytes
+    data = np.memmap(filename, dtype="<u4", mode="r", offset=header_dtype.itemsize)
+    timestep_words = (header["pop_size"] + 31) // 32
+    data_bytes = np.reshape(data.view(np.uint8),
+                            (-1, header["batch_size"], timestep_words * 4))
+
+    # Unpack bits of chosen batch (results in one byte per bit)
+    data_unpack = np.unpackbits(data_bytes[:, batch, :], axis=1,
+                                count=header["pop_size"], bitorder="little")
+
+    # Calculate indices where there are spikes and convert timesteps to ms
+    spikes = np.where(data_unpack == 1)
+    return header["start_time"] + (spikes[0] * header["dt"]), spikes[1]
+
+def plot(filename, time_range, neuron_range, axis, yoffset=0):
+    # Load data
+    times, neurons = load(filename)
+
+    # If a time or neuron range were specified
+    if time_range is not None or neuron_range is not None:
+        # Create a mask (initially all valid)
+        mask = np.ones(times.shape, dtype=bool)
+
+        # If a time range is specified, and it with mask
+        if time_range is not None:
+            mask &= ((times >= time_range[0]) & (times < time_range[1]))
+
+        # If a neuron range is specified, and it with mask
+        if neuron_range is not None:
+            mask &= ((neurons >= neuron_range[0]) & (neurons < neuron_range[1]))
+
+        # Apply mask
+        times = times[mask]
+        neurons = neurons[mask]
+
+    # Plot spikes
+    return axis.scatter(times, neurons + yoffset, s=1)
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2:
+        print("Usage: spike_recording.py filename [min_time max_time] [min_neuron max_neuron]")
+    else:
+        # Parse time range
+        time_range = None
+        if len(sys.argv) > 3:
+            time_range = (float(sys.argv[2]), float(sys.argv[3]))
+
+        # Parse neuron range
+        neuron_range = None
+        if len(sys.argv) > 5:
+            neuron_range = (int(sys.argv[4]), int(sys.argv[5]))
+
+        # Plot and show figure
+        fig, axis = plt.subplots()
+        plot(sys.argv[1], time_range, neuron_range, axis)
+        axis.set_xlabel("Time [ms]")
+        axis.set_ylabel("Neuron number")
+        plt.show()